@@ -0,0 +1,113 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Benchmark.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+#include <algorithm>
+
+namespace Benchmarks
+{
+
+void Benchmark::Run(OctaneGUI::Application& Application, const std::string& Filter, OctaneGUI::Json& Results)
+{
+    if (s_Benchmarks == nullptr)
+    {
+        printf("No benchmarks to run.\n");
+        return;
+    }
+
+    printf("%-32s %10s %12s %12s %12s\n", "Benchmark", "Iterations", "Min (ms)", "Median (ms)", "Max (ms)");
+    for (const Benchmark* Item : *s_Benchmarks)
+    {
+        if (!Filter.empty() && Filter != Item->m_Name)
+        {
+            continue;
+        }
+
+        Run(Application, *Item, Results);
+    }
+
+    delete s_Benchmarks;
+    s_Benchmarks = nullptr;
+}
+
+Benchmark::Benchmark(const char* Name, int Iterations, OnRunSignature&& Setup, OnRunSignature&& Fn)
+    : m_Name(Name)
+    , m_Iterations(std::max<int>(Iterations, 1))
+    , m_Setup(std::move(Setup))
+    , m_Fn(std::move(Fn))
+{
+    if (s_Benchmarks == nullptr)
+    {
+        s_Benchmarks = new std::vector<Benchmark*>();
+    }
+
+    s_Benchmarks->push_back(this);
+}
+
+Benchmark::~Benchmark()
+{
+}
+
+void Benchmark::Run(OctaneGUI::Application& Application, const Benchmark& Item, OctaneGUI::Json& Results)
+{
+    Application.GetMainWindow()->Clear();
+
+    if (Item.m_Setup)
+    {
+        Item.m_Setup(Application);
+    }
+
+    std::vector<float> Times;
+    Times.reserve(Item.m_Iterations);
+
+    for (int I = 0; I < Item.m_Iterations; I++)
+    {
+        OctaneGUI::Clock Clock;
+        Item.m_Fn(Application);
+        Times.push_back(Clock.Measure() * 1000.0f);
+    }
+
+    std::sort(Times.begin(), Times.end());
+    printf("%-32s %10d %12.4f %12.4f %12.4f\n", Item.m_Name.c_str(), Item.m_Iterations, Times.front(), Times[Times.size() / 2], Times.back());
+
+    OctaneGUI::Json Result(OctaneGUI::Json::Type::Object);
+    Result["Name"] = Item.m_Name;
+    Result["Iterations"] = (float)Item.m_Iterations;
+    Result["Min"] = Times.front();
+    Result["Median"] = Times[Times.size() / 2];
+    Result["Max"] = Times.back();
+    Results.Push(std::move(Result));
+}
+
+Benchmark::Benchmark()
+{
+}
+
+std::vector<Benchmark*>* Benchmark::s_Benchmarks = nullptr;
+
+}
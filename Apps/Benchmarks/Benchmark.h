@@ -0,0 +1,71 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class Application;
+class Json;
+
+}
+
+namespace Benchmarks
+{
+
+class Benchmark
+{
+public:
+    typedef std::function<void(OctaneGUI::Application&)> OnRunSignature;
+
+    static void Run(OctaneGUI::Application& Application, const std::string& Filter, OctaneGUI::Json& Results);
+
+    Benchmark(const char* Name, int Iterations, OnRunSignature&& Setup, OnRunSignature&& Fn);
+    ~Benchmark();
+
+private:
+    static void Run(OctaneGUI::Application& Application, const Benchmark& Item, OctaneGUI::Json& Results);
+
+    Benchmark();
+
+    // Allocated on the heap due to static initialization order. Same approach as the test suites.
+    static std::vector<Benchmark*>* s_Benchmarks;
+
+    std::string m_Name {};
+    int m_Iterations { 1 };
+    OnRunSignature m_Setup { nullptr };
+    OnRunSignature m_Fn { nullptr };
+};
+
+// Setup is run once before timing begins. Fn is timed for each iteration.
+#define BENCHMARK(Name, Iterations, Setup, Fn) Benchmark Name(#Name, Iterations, [](OctaneGUI::Application& Application) -> void Setup, [](OctaneGUI::Application& Application) -> void Fn);
+
+}
@@ -0,0 +1,70 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Benchmark.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+namespace Benchmarks
+{
+
+static std::shared_ptr<OctaneGUI::VerticalContainer> g_List { nullptr };
+static std::shared_ptr<OctaneGUI::VerticalContainer> g_Rows { nullptr };
+
+BENCHMARK(VerticalContainer10k, 100,
+{
+    g_List = Application.GetMainWindow()->GetContainer()->AddControl<OctaneGUI::VerticalContainer>();
+    for (int I = 0; I < 10000; I++)
+    {
+        g_List->AddControl<OctaneGUI::Text>()->SetText("Item");
+    }
+},
+{
+    g_List->Layout();
+})
+
+// Lays out rows of nested containers whose contents do not change between iterations. The
+// desired size of each container is memoized, so only the placement of each control is redone.
+BENCHMARK(NestedContainers, 100,
+{
+    g_Rows = Application.GetMainWindow()->GetContainer()->AddControl<OctaneGUI::VerticalContainer>();
+    for (int I = 0; I < 500; I++)
+    {
+        const std::shared_ptr<OctaneGUI::HorizontalContainer> Row = g_Rows->AddControl<OctaneGUI::HorizontalContainer>();
+        for (int J = 0; J < 4; J++)
+        {
+            Row->AddControl<OctaneGUI::MarginContainer>()
+                ->AddControl<OctaneGUI::VerticalContainer>()
+                ->AddControl<OctaneGUI::Text>()
+                ->SetText("Item");
+        }
+    }
+    g_Rows->Layout();
+},
+{
+    g_Rows->Layout();
+})
+
+}
@@ -0,0 +1,118 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "Benchmark.h"
+#include "Scenario.h"
+
+#include <fstream>
+
+uint32_t TextureID = 0;
+
+void OnWindowAction(OctaneGUI::Window* Window, OctaneGUI::WindowAction Action)
+{
+}
+
+OctaneGUI::Event OnEvent(OctaneGUI::Window* Window)
+{
+    return OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed);
+}
+
+void OnPaint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffers)
+{
+}
+
+uint32_t OnLoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
+{
+    return ++TextureID;
+}
+
+void OnExit()
+{
+}
+
+int main(int argc, char** argv)
+{
+    OctaneGUI::Application Application;
+    Application
+        .SetOnWindowAction(OnWindowAction)
+        .SetOnEvent(OnEvent)
+        .SetOnPaint(OnPaint)
+        .SetOnLoadTexture(OnLoadTexture)
+        .SetOnExit(OnExit);
+    
+    const char* Json = 
+    R"({
+        "Theme": {"FontPath": "Resources/Roboto-Regular.ttf", "FontSize": 18},
+        "Windows": {"Main": {"Title": "Benchmarks", "Width": 1280, "Height": 720}}
+    })";
+    
+    std::unordered_map<std::string, OctaneGUI::ControlList> WindowControls;
+    if (!Application.Initialize(Json, WindowControls))
+    {
+        printf("Failed to initialize application.\n");
+        return -1;
+    }
+
+    // Arguments are an optional benchmark or scenario name to run and '--json <Path>' to
+    // write the results to a file for comparing between builds.
+    std::string Filter;
+    std::string JsonPath;
+    for (int I = 1; I < argc; I++)
+    {
+        const std::string Arg = argv[I];
+        if (Arg == "--json" && I + 1 < argc)
+        {
+            JsonPath = argv[++I];
+        }
+        else
+        {
+            Filter = Arg;
+        }
+    }
+
+    OctaneGUI::Json Results(OctaneGUI::Json::Type::Object);
+    Results["Benchmarks"] = OctaneGUI::Json(OctaneGUI::Json::Type::Array);
+    Results["Scenarios"] = OctaneGUI::Json(OctaneGUI::Json::Type::Array);
+
+    Benchmarks::Benchmark::Run(Application, Filter, Results["Benchmarks"]);
+    Benchmarks::Scenario::Run(Application, Filter, Results["Scenarios"]);
+
+    if (!JsonPath.empty())
+    {
+        std::ofstream Stream(JsonPath);
+        if (!Stream.is_open())
+        {
+            printf("Failed to write results to '%s'.\n", JsonPath.c_str());
+            return -1;
+        }
+
+        Stream << Results.ToStringPretty() << std::endl;
+    }
+
+    // This should return immediately with stubbed functions.
+    return Application.Run();
+}
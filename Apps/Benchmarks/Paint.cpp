@@ -0,0 +1,79 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Benchmark.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+namespace Benchmarks
+{
+
+static OctaneGUI::VertexBuffer g_PaintBuffer {};
+
+BENCHMARK(RoundedRectangles10k, 20,
+{
+},
+{
+    g_PaintBuffer.Clear();
+    OctaneGUI::Paint Brush(g_PaintBuffer, Application.GetTheme());
+    for (int I = 0; I < 10000; I++)
+    {
+        const float X = (float)(I % 100) * 20.0f;
+        const float Y = (float)(I / 100) * 30.0f;
+        Brush.Rectangle3DRounded({ X, Y, X + 18.0f, Y + 26.0f }, { 4.0f, 4.0f, 4.0f, 4.0f }, OctaneGUI::Color::White, OctaneGUI::Color::White, OctaneGUI::Color::Black);
+    }
+})
+
+BENCHMARK(Circles10k, 20,
+{
+},
+{
+    g_PaintBuffer.Clear();
+    OctaneGUI::Paint Brush(g_PaintBuffer, Application.GetTheme());
+    for (int I = 0; I < 10000; I++)
+    {
+        const OctaneGUI::Vector2 Center((float)(I % 100) * 20.0f, (float)(I / 100) * 20.0f);
+        Brush.Circle(Center, 6.0f, OctaneGUI::Color::White);
+        Brush.CircleOutline(Center, 6.0f, OctaneGUI::Color::Black);
+    }
+})
+
+
+BENCHMARK(Circles10kAntiAliased, 20,
+{
+},
+{
+    g_PaintBuffer.Clear();
+    OctaneGUI::Paint Brush(g_PaintBuffer, Application.GetTheme());
+    Brush.SetAntiAliased(true);
+    for (int I = 0; I < 10000; I++)
+    {
+        const OctaneGUI::Vector2 Center((float)(I % 100) * 20.0f, (float)(I / 100) * 20.0f);
+        Brush.Circle(Center, 6.0f, OctaneGUI::Color::White);
+        Brush.CircleOutline(Center, 6.0f, OctaneGUI::Color::Black);
+    }
+})
+
+}
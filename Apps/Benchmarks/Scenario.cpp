@@ -0,0 +1,207 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Scenario.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Benchmarks
+{
+
+struct Samples
+{
+public:
+    std::vector<float> Values {};
+
+    float Percentile(float Percent) const
+    {
+        if (Values.empty())
+        {
+            return 0.0f;
+        }
+
+        const size_t Index = (size_t)std::ceil(Percent * (float)Values.size());
+        return Values[std::min<size_t>(Index > 0 ? Index - 1 : 0, Values.size() - 1)];
+    }
+
+    OctaneGUI::Json ToJson()
+    {
+        std::sort(Values.begin(), Values.end());
+
+        OctaneGUI::Json Result(OctaneGUI::Json::Type::Object);
+        Result["P50"] = Percentile(0.5f);
+        Result["P99"] = Percentile(0.99f);
+        Result["Max"] = Values.empty() ? 0.0f : Values.back();
+        return Result;
+    }
+};
+
+void Scenario::Run(OctaneGUI::Application& Application, const std::string& Filter, OctaneGUI::Json& Results)
+{
+    if (s_Scenarios == nullptr)
+    {
+        return;
+    }
+
+    printf("\n%-32s %8s %10s %12s %12s %12s %12s %10s %10s\n", "Scenario", "Frames", "Load (ms)", "Update p50", "Update p99", "Paint p50", "Paint p99", "Verts p50", "Verts p99");
+    for (const Scenario* Item : *s_Scenarios)
+    {
+        if (!Filter.empty() && Filter != Item->m_Name)
+        {
+            continue;
+        }
+
+        Run(Application, *Item, Results);
+    }
+
+    delete s_Scenarios;
+    s_Scenarios = nullptr;
+}
+
+Scenario::Scenario(const char* Name, const char* Stream, OnSetupSignature&& Setup)
+    : m_Name(Name)
+    , m_Stream(Stream)
+    , m_Setup(std::move(Setup))
+{
+    if (s_Scenarios == nullptr)
+    {
+        s_Scenarios = new std::vector<Scenario*>();
+    }
+
+    s_Scenarios->push_back(this);
+}
+
+Scenario::~Scenario()
+{
+}
+
+void Scenario::Run(OctaneGUI::Application& Application, const Scenario& Item, OctaneGUI::Json& Results)
+{
+    bool IsError = false;
+    const OctaneGUI::Json Root = OctaneGUI::Json::Parse(Item.m_Stream, IsError);
+    if (IsError)
+    {
+        printf("Failed to parse scenario '%s'.\n", Item.m_Name.c_str());
+        return;
+    }
+
+    std::vector<OctaneGUI::EventScript::Item> Script;
+    uint64_t Frame = 0;
+    if (!OctaneGUI::EventScript::Parse(Root["Script"], Frame, Script))
+    {
+        printf("Scenario '%s' has an invalid script.\n", Item.m_Name.c_str());
+    }
+
+    const uint32_t Frames = std::max<uint32_t>((uint32_t)Root["Frames"].Number(0.0f), (uint32_t)Frame + 1);
+
+    bool Painted = false;
+    uint32_t Vertices = 0;
+    Application.SetOnPaint([&](OctaneGUI::Window*, const OctaneGUI::VertexBuffer& Buffer) -> void
+        {
+            Painted = true;
+            Vertices = Buffer.GetVertexCount();
+        });
+
+    std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    Window->Clear();
+
+    // The first frame lays out and paints all of the contents. This is reported separately
+    // from the interactive frames.
+    OctaneGUI::Clock LoadClock;
+    OctaneGUI::ControlList List;
+    Window->Load(Root["Window"], List);
+    if (Item.m_Setup)
+    {
+        Item.m_Setup(Application, List);
+    }
+    Window->Update();
+    Window->DoPaint();
+    const float LoadTime = LoadClock.Measure() * 1000.0f;
+
+    Samples UpdateTimes;
+    Samples PaintTimes;
+    Samples VertexCounts;
+    UpdateTimes.Values.reserve(Frames);
+
+    std::vector<OctaneGUI::EventScript::Item>::const_iterator Next = Script.begin();
+    for (uint32_t I = 0; I < Frames; I++)
+    {
+        for (; Next != Script.end() && Next->Frame == I; ++Next)
+        {
+            Application.DispatchEvent(Window, Next->Value);
+        }
+
+        OctaneGUI::Clock Clock;
+        Window->Update();
+        UpdateTimes.Values.push_back(Clock.Measure() * 1000.0f);
+
+        Painted = false;
+        Clock.Reset();
+        Window->DoPaint();
+        const float PaintTime = Clock.Measure() * 1000.0f;
+
+        if (Painted)
+        {
+            PaintTimes.Values.push_back(PaintTime);
+            VertexCounts.Values.push_back((float)Vertices);
+        }
+    }
+
+    Window->Clear();
+    Application.SetOnPaint(nullptr);
+
+    OctaneGUI::Json Result(OctaneGUI::Json::Type::Object);
+    Result["Name"] = Item.m_Name;
+    Result["Frames"] = (float)Frames;
+    Result["PaintedFrames"] = (float)PaintTimes.Values.size();
+    Result["Load"] = LoadTime;
+    Result["Update"] = UpdateTimes.ToJson();
+    Result["Paint"] = PaintTimes.ToJson();
+    Result["Vertices"] = VertexCounts.ToJson();
+
+    printf("%-32s %8u %10.3f %12.4f %12.4f %12.4f %12.4f %10.0f %10.0f\n",
+        Item.m_Name.c_str(),
+        Frames,
+        LoadTime,
+        Result["Update"]["P50"].Number(),
+        Result["Update"]["P99"].Number(),
+        Result["Paint"]["P50"].Number(),
+        Result["Paint"]["P99"].Number(),
+        Result["Vertices"]["P50"].Number(),
+        Result["Vertices"]["P99"].Number());
+
+    Results.Push(std::move(Result));
+}
+
+Scenario::Scenario()
+{
+}
+
+std::vector<Scenario*>* Scenario::s_Scenarios = nullptr;
+
+}
@@ -0,0 +1,81 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class Application;
+class ControlList;
+class Json;
+
+}
+
+namespace Benchmarks
+{
+
+/// @brief A benchmark that measures whole frames of a window instead of a single function.
+///
+/// A scenario is described by a JSON document. The 'Window' object is loaded into the main
+/// window the same way a window is loaded from an application stream. The 'Script' object
+/// is an input script in the format described by OctaneGUI::EventScript and is played back
+/// one frame at a time, with every event sent to the main window. The scenario runs until
+/// the script is finished and at least 'Frames' frames have run.
+///
+/// For every frame, the time spent in Window::Update and Window::DoPaint is recorded along
+/// with the number of vertices painted.
+class Scenario
+{
+public:
+    typedef std::function<void(OctaneGUI::Application&, const OctaneGUI::ControlList&)> OnSetupSignature;
+
+    static void Run(OctaneGUI::Application& Application, const std::string& Filter, OctaneGUI::Json& Results);
+
+    Scenario(const char* Name, const char* Stream, OnSetupSignature&& Setup);
+    ~Scenario();
+
+private:
+    static void Run(OctaneGUI::Application& Application, const Scenario& Item, OctaneGUI::Json& Results);
+
+    Scenario();
+
+    // Allocated on the heap due to static initialization order. Same approach as the benchmarks.
+    static std::vector<Scenario*>* s_Scenarios;
+
+    std::string m_Name {};
+    const char* m_Stream { nullptr };
+    OnSetupSignature m_Setup { nullptr };
+};
+
+// Setup is run after the layout is loaded to generate contents that are too large to describe in JSON.
+#define SCENARIO(Name, Stream, Setup) Scenario Name(#Name, Stream, [](OctaneGUI::Application& Application, const OctaneGUI::ControlList& List) -> void Setup);
+
+}
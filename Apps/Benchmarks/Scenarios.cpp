@@ -0,0 +1,190 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/Controls/Tree.h"
+#include "OctaneGUI/OctaneGUI.h"
+#include "Scenario.h"
+
+namespace Benchmarks
+{
+
+static void AddTreeChildren(const std::shared_ptr<OctaneGUI::Tree>& Parent, int Depth)
+{
+    if (Depth <= 0)
+    {
+        return;
+    }
+
+    for (int I = 0; I < 4; I++)
+    {
+        const std::string Text = "Item " + std::to_string(Depth) + "." + std::to_string(I);
+        AddTreeChildren(Parent->AddChild(Text.c_str()), Depth - 1);
+    }
+}
+
+SCENARIO(ListBox10k,
+R"({
+    "Window": {"Width": 1280, "Height": 720, "Body": {"Controls": [
+        {"ID": "List", "Type": "ListBox", "Expand": "Both"}
+    ]}},
+    "Script": {"Events": [
+        {"Type": "MouseMoved", "Position": [200, 100]},
+        {"Type": "Wait"},
+        {"Type": "Repeat", "Count": 100, "Events": [
+            {"Type": "MouseWheel", "Delta": [0, -1]},
+            {"Type": "Wait"}
+        ]},
+        {"Type": "MousePressed", "Position": [200, 100], "Button": "Left"},
+        {"Type": "MouseReleased", "Position": [200, 100], "Button": "Left"},
+        {"Type": "Wait"},
+        {"Type": "Repeat", "Count": 50, "Events": [
+            {"Type": "MouseMoved", "Position": [200, 300]},
+            {"Type": "Wait"},
+            {"Type": "MouseMoved", "Position": [200, 320]},
+            {"Type": "Wait"}
+        ]}
+    ]}
+})",
+{
+    std::shared_ptr<OctaneGUI::ListBox> ListBox = List.To<OctaneGUI::ListBox>("List");
+    for (int I = 0; I < 10000; I++)
+    {
+        ListBox->AddItem<OctaneGUI::Text>()->SetText(("Item " + std::to_string(I)).c_str());
+    }
+})
+
+SCENARIO(TreeExpandAll,
+R"({
+    "Window": {"Width": 1280, "Height": 720, "Body": {"Controls": [
+        {"ID": "Scroll", "Type": "ScrollableContainer", "Expand": "Both", "Controls": [
+            {"ID": "Tree", "Type": "Tree", "Text": "Root"}
+        ]}
+    ]}},
+    "Script": {"Events": [
+        {"Type": "Repeat", "Count": 20, "Events": [
+            {"Type": "MouseMoved", "Position": [8, 8]},
+            {"Type": "MousePressed", "Position": [8, 8], "Button": "Left"},
+            {"Type": "MouseReleased", "Position": [8, 8], "Button": "Left"},
+            {"Type": "Wait", "Frames": 2}
+        ]},
+        {"Type": "Repeat", "Count": 40, "Events": [
+            {"Type": "MouseWheel", "Delta": [0, -4]},
+            {"Type": "Wait"}
+        ]}
+    ]}
+})",
+{
+    // Four children per item and five levels deep results in 1364 items below the root. Building
+    // the tree slows down quickly past this size.
+    std::shared_ptr<OctaneGUI::Tree> Tree = List.To<OctaneGUI::Tree>("Scroll.Tree");
+    AddTreeChildren(Tree, 5);
+    Tree->SetExpandedAll(true);
+})
+
+SCENARIO(TextEditor1MB,
+R"({
+    "Window": {"Width": 1280, "Height": 720, "Body": {"Controls": [
+        {"ID": "Editor", "Type": "TextEditor", "Expand": "Both"}
+    ]}},
+    "Script": {"Events": [
+        {"Type": "MouseMoved", "Position": [300, 200]},
+        {"Type": "MousePressed", "Position": [300, 200], "Button": "Left"},
+        {"Type": "MouseReleased", "Position": [300, 200], "Button": "Left"},
+        {"Type": "Wait"},
+        {"Type": "Repeat", "Count": 4, "Events": [
+            {"Type": "Repeat", "Count": 24, "Events": [
+                {"Type": "Text", "Text": "a"},
+                {"Type": "Wait"}
+            ]},
+            {"Type": "KeyPressed", "Key": "Enter"},
+            {"Type": "KeyReleased", "Key": "Enter"},
+            {"Type": "Wait"},
+            {"Type": "Repeat", "Count": 8, "Events": [
+                {"Type": "KeyPressed", "Key": "Backspace"},
+                {"Type": "KeyReleased", "Key": "Backspace"},
+                {"Type": "Wait"}
+            ]}
+        ]},
+        {"Type": "Repeat", "Count": 20, "Events": [
+            {"Type": "MouseWheel", "Delta": [0, -4]},
+            {"Type": "Wait"}
+        ]}
+    ]}
+})",
+{
+    std::string Contents;
+    Contents.reserve(1024 * 1024 + 128);
+    for (int I = 0; Contents.size() < 1024 * 1024; I++)
+    {
+        Contents += "    const int Value" + std::to_string(I) + " = Compute(" + std::to_string(I) + ", Other); // Some trailing comment text.\n";
+    }
+
+    List.To<OctaneGUI::TextEditor>("Editor")->SetText(Contents.c_str());
+})
+
+SCENARIO(SplitterResize,
+R"({
+    "Window": {"Width": 1280, "Height": 720, "Body": {"Controls": [
+        {"Type": "Splitter", "Orientation": "Vertical", "Expand": "Both",
+            "First": {"Controls": [
+                {"Type": "VerticalContainer", "Expand": "Both", "Controls": [
+                    {"Type": "Text", "Text": "Left Panel"},
+                    {"Type": "TextButton", "Text": {"Text": "Button"}},
+                    {"Type": "CheckBox", "Text": {"Text": "CheckBox"}}
+                ]}
+            ]},
+            "Second": {"Controls": [
+                {"Type": "Splitter", "Orientation": "Horizontal", "Expand": "Both",
+                    "First": {"Controls": [
+                        {"Type": "Splitter", "Orientation": "Vertical", "Expand": "Both",
+                            "First": {"Controls": [{"Type": "Text", "Text": "Top Left"}]},
+                            "Second": {"Controls": [{"Type": "Text", "Text": "Top Right"}]}
+                        }
+                    ]},
+                    "Second": {"Controls": [
+                        {"Type": "TextInput", "Expand": "Both", "Text": {"Text": "Bottom"}}
+                    ]}
+                }
+            ]}
+        }
+    ]}},
+    "Script": {"Events": [
+        {"Type": "Repeat", "Count": 30, "Events": [
+            {"Type": "WindowResized", "Size": [1200, 680]},
+            {"Type": "Wait"},
+            {"Type": "WindowResized", "Size": [1000, 600]},
+            {"Type": "Wait"},
+            {"Type": "WindowResized", "Size": [800, 500]},
+            {"Type": "Wait"},
+            {"Type": "WindowResized", "Size": [1280, 720]},
+            {"Type": "Wait"}
+        ]}
+    ]}
+})",
+{
+})
+
+}
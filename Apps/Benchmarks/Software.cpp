@@ -0,0 +1,95 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Benchmark.h"
+#include "OctaneGUI/OctaneGUI.h"
+#include "Rendering/Rendering.h"
+#include "Rendering/Software/Interface.h"
+
+namespace Benchmarks
+{
+
+static OctaneGUI::VertexBuffer g_RasterBuffer {};
+
+// Overlapping translucent rounded rectangles that cover the window, painted once and rasterized with
+// a different number of threads by each benchmark.
+static void SetupRaster(OctaneGUI::Application& Application, uint32_t ThreadCount)
+{
+    Frontend::Rendering::SetThreadCount(ThreadCount);
+    Application.GetMainWindow()->SetSize({ 1280.0f, 720.0f });
+
+    if (g_RasterBuffer.GetVertexCount() > 0)
+    {
+        return;
+    }
+
+    OctaneGUI::Paint Brush(g_RasterBuffer, Application.GetTheme());
+    for (int I = 0; I < 4000; I++)
+    {
+        const float X = (float)(I % 80) * 16.0f;
+        const float Y = (float)(I / 80) * 14.4f;
+        Brush.RectangleRounded({ X, Y, X + 40.0f, Y + 30.0f }, OctaneGUI::Color(255, 128, 64, 96), { 4.0f, 4.0f, 4.0f, 4.0f });
+    }
+}
+
+static void Raster(OctaneGUI::Application& Application)
+{
+    Frontend::Rendering::Paint(Application.GetMainWindow().get(), g_RasterBuffer);
+}
+
+BENCHMARK(SoftwareRaster1Thread, 50,
+{
+    SetupRaster(Application, 1);
+},
+{
+    Raster(Application);
+})
+
+BENCHMARK(SoftwareRaster2Threads, 50,
+{
+    SetupRaster(Application, 2);
+},
+{
+    Raster(Application);
+})
+
+BENCHMARK(SoftwareRaster4Threads, 50,
+{
+    SetupRaster(Application, 4);
+},
+{
+    Raster(Application);
+})
+
+BENCHMARK(SoftwareRaster8Threads, 50,
+{
+    SetupRaster(Application, 8);
+},
+{
+    Raster(Application);
+})
+
+}
@@ -0,0 +1,72 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Benchmark.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+#include <filesystem>
+
+namespace Benchmarks
+{
+
+static std::u32string g_Contents {};
+
+BENCHMARK(MeasureText100k, 100,
+{
+    g_Contents.clear();
+    for (int I = 0; I < 2000; I++)
+    {
+        g_Contents += U"The quick brown fox jumps over the lazy dog. Sphinx of black quartz!\n";
+    }
+},
+{
+    int Lines = 0;
+    Application.GetTheme()->GetFont()->Measure(g_Contents, Lines);
+})
+
+static std::string g_CacheDirectory {};
+
+BENCHMARK(LoadFont, 20,
+{
+},
+{
+    OctaneGUI::Font::Create(Application.GetTheme()->GetFont()->Path(), 24.0f);
+})
+
+BENCHMARK(LoadFontCached, 20,
+{
+    g_CacheDirectory = (std::filesystem::temp_directory_path() / "OctaneGUIBenchmarks").string();
+    OctaneGUI::Font::SetCacheDirectory(g_CacheDirectory.c_str());
+    OctaneGUI::Font::Create(Application.GetTheme()->GetFont()->Path(), 24.0f);
+    OctaneGUI::Font::SetCacheDirectory("");
+},
+{
+    OctaneGUI::Font::SetCacheDirectory(g_CacheDirectory.c_str());
+    OctaneGUI::Font::Create(Application.GetTheme()->GetFont()->Path(), 24.0f);
+    OctaneGUI::Font::SetCacheDirectory("");
+})
+
+}
@@ -0,0 +1,109 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Benchmark.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+namespace Benchmarks
+{
+
+#define QUAD_COUNT 1000000
+
+static std::vector<OctaneGUI::Rect> g_Rects {};
+static std::vector<OctaneGUI::Rect> g_UVs {};
+static std::vector<OctaneGUI::Color> g_Colors {};
+static OctaneGUI::VertexBuffer g_Buffer {};
+
+static void FillQuads()
+{
+    g_Rects.resize(QUAD_COUNT);
+    g_UVs.resize(QUAD_COUNT);
+    g_Colors.resize(QUAD_COUNT, OctaneGUI::Color::White);
+    for (int I = 0; I < QUAD_COUNT; I++)
+    {
+        const float X = (float)(I % 200) * 9.0f;
+        const float Y = (float)(I / 200) * 18.0f;
+        g_Rects[I] = { X, Y, X + 8.0f, Y + 14.0f };
+        g_UVs[I] = { 0.1f, 0.2f, 0.15f, 0.3f };
+    }
+
+    // Emit once so the timed runs reuse the buffer's storage like a window does between frames.
+    g_Buffer.Clear();
+    g_Buffer.PushCommand(QUAD_COUNT * 6, 1, {});
+    g_Buffer.AddQuads(g_Rects.data(), g_UVs.data(), g_Colors.data(), QUAD_COUNT);
+}
+
+BENCHMARK(EmitQuads1M, 20,
+{
+    FillQuads();
+},
+{
+    g_Buffer.Clear();
+    g_Buffer.PushCommand(QUAD_COUNT * 6, 1, {});
+    g_Buffer.AddQuads(g_Rects.data(), g_UVs.data(), g_Colors.data(), QUAD_COUNT);
+})
+
+BENCHMARK(EmitQuads1MScalar, 20,
+{
+    FillQuads();
+},
+{
+    const bool SIMD = OctaneGUI::VertexBuffer::SIMD();
+    OctaneGUI::VertexBuffer::SetSIMD(false);
+    g_Buffer.Clear();
+    g_Buffer.PushCommand(QUAD_COUNT * 6, 1, {});
+    g_Buffer.AddQuads(g_Rects.data(), g_UVs.data(), g_Colors.data(), QUAD_COUNT);
+    OctaneGUI::VertexBuffer::SetSIMD(SIMD);
+})
+
+// The previous approach of adding each vertex and index individually.
+BENCHMARK(EmitQuads1MPerVertex, 20,
+{
+    FillQuads();
+},
+{
+    g_Buffer.Clear();
+    g_Buffer.PushCommand(QUAD_COUNT * 6, 1, {});
+    for (int I = 0; I < QUAD_COUNT; I++)
+    {
+        const OctaneGUI::Rect& Bounds = g_Rects[I];
+        const OctaneGUI::Rect& TexCoords = g_UVs[I];
+        const OctaneGUI::Color& Col = g_Colors[I];
+        const uint32_t Offset = I * 4;
+        g_Buffer.AddVertex(Bounds.Min, TexCoords.Min, Col);
+        g_Buffer.AddVertex({ Bounds.Max.X, Bounds.Min.Y }, { TexCoords.Max.X, TexCoords.Min.Y }, Col);
+        g_Buffer.AddVertex(Bounds.Max, TexCoords.Max, Col);
+        g_Buffer.AddVertex({ Bounds.Min.X, Bounds.Max.Y }, { TexCoords.Min.X, TexCoords.Max.Y }, Col);
+        g_Buffer.AddIndex(Offset);
+        g_Buffer.AddIndex(Offset + 1);
+        g_Buffer.AddIndex(Offset + 2);
+        g_Buffer.AddIndex(Offset);
+        g_Buffer.AddIndex(Offset + 2);
+        g_Buffer.AddIndex(Offset + 3);
+    }
+})
+
+}
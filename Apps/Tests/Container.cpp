@@ -357,6 +357,186 @@ TEST_CASE(VerticalSpacing,
         Button2->GetPosition().Y + Button2->GetSize().Y == Container->GetSize().Y;
 })
 
+TEST_CASE(DesiredSizeNested,
+{
+    OctaneGUI::ControlList List;
+    Load(Application, R"({"ID": "Outer", "Type": "VerticalContainer", "Controls": [
+        {"ID": "Inner", "Type": "HorizontalContainer", "Controls": [
+            {"ID": "Label", "Type": "Text", "Text": "Hello"}
+        ]}
+    ]})", List);
+
+    const std::shared_ptr<OctaneGUI::VerticalContainer> Outer = List.To<OctaneGUI::VerticalContainer>("Outer");
+    const std::shared_ptr<OctaneGUI::HorizontalContainer> Inner = List.To<OctaneGUI::HorizontalContainer>("Outer.Inner");
+    const std::shared_ptr<OctaneGUI::Text> Label = List.To<OctaneGUI::Text>("Outer.Inner.Label");
+
+    const OctaneGUI::Vector2 Before = Outer->DesiredSize();
+    VERIFY(Before == Label->GetSize());
+
+    Label->SetText("Hello World");
+    Application.Update();
+
+    const OctaneGUI::Vector2 After = Outer->DesiredSize();
+    VERIFYF(After.X > Before.X, "Desired size did not update after the text changed: %.2f <= %.2f\n", After.X, Before.X);
+    VERIFY(After == Label->GetSize());
+
+    Inner->SetSpacing({ 4.0f, 4.0f });
+    Inner->AddControl<OctaneGUI::Text>()->SetText("Again");
+    VERIFY(Outer->DesiredSize().X > After.X + 4.0f);
+
+    Inner->ClearControls();
+    return Outer->DesiredSize().IsZero();
+})
+
+TEST_CASE(CachePaintReplay,
+{
+    OctaneGUI::ControlList List;
+    Load(Application,
+        R"({"Type": "HorizontalContainer", "Controls": [
+        {"ID": "Cached", "Type": "VerticalContainer", "CachePaint": true, "Controls": [
+            {"Type": "Text", "Text": "Cached Text"},
+            {"Type": "TextButton", "Text": {"Text": "Cached Button"}}]},
+        {"ID": "Button", "Type": "TextButton", "Text": {"Text": "Button"}}]})",
+        List);
+
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const std::shared_ptr<OctaneGUI::Button> Button = List.To<OctaneGUI::Button>("Button");
+    Application.Update();
+
+    const std::vector<OctaneGUI::Vertex> Vertices = Window->GetBuffer().GetVertices();
+    const size_t Commands = Window->GetBuffer().Commands().size();
+
+    // Hover and leave the uncached button so that the window is repainted with the cached container replayed.
+    Utility::MouseMove(Application, Button->GetAbsoluteBounds().GetCenter());
+    Application.Update();
+    Utility::MouseMove(Application, { -1.0f, -1.0f });
+    Application.Update();
+
+    const OctaneGUI::VertexBuffer& Buffer = Window->GetBuffer();
+    VERIFYF(Buffer.Commands().size() == Commands, "Command count differs: %zu != %zu\n", Buffer.Commands().size(), Commands);
+    VERIFYF(Buffer.GetVertices().size() == Vertices.size(), "Vertex count differs: %zu != %zu\n", Buffer.GetVertices().size(), Vertices.size());
+
+    for (size_t I = 0; I < Vertices.size(); I++)
+    {
+        VERIFY(Buffer.GetVertices()[I].Position == Vertices[I].Position);
+    }
+
+    return true;
+})
+
+TEST_CASE(CachePaintGlyphEvicted,
+{
+    // The cached text is the only glyph of a font with a single dynamic cell.
+    const int Capacity = OctaneGUI::Font::GlyphCapacity();
+    OctaneGUI::Font::SetGlyphCapacity(1);
+    OctaneGUI::ControlList List;
+    Load(Application,
+        R"({"Type": "HorizontalContainer", "Controls": [
+        {"ID": "Cached", "Type": "VerticalContainer", "CachePaint": true, "Controls": [
+            {"ID": "Text", "Type": "Text", "FontSize": 21}]},
+        {"ID": "Button", "Type": "TextButton", "Text": {"Text": "Button"}}]})",
+        List);
+    OctaneGUI::Font::SetGlyphCapacity(Capacity);
+
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const std::shared_ptr<OctaneGUI::Button> Button = List.To<OctaneGUI::Button>("Button");
+    const std::shared_ptr<OctaneGUI::Text> Text = List.To<OctaneGUI::Text>("Cached.Text");
+    Text->SetText(U"\u03b1");
+    Application.Update();
+
+    // Beta replaces alpha in the atlas, and alpha is loaded again into a grown texture when repainted.
+    const std::shared_ptr<OctaneGUI::Font> Font = Text->GetFont();
+    const uint32_t PreviousID = Font->ID();
+    Font->Measure((uint32_t)0x3B2);
+
+    Utility::MouseMove(Application, Button->GetAbsoluteBounds().GetCenter());
+    Application.Update();
+
+    OctaneGUI::Vector2 Position;
+    OctaneGUI::Rect Vertices;
+    OctaneGUI::Rect TexCoords;
+    Font->Draw(0x3B1, Position, Vertices, TexCoords);
+    VERIFYF(Font->ID() != PreviousID, "Expected the font texture to be replaced: %u\n", Font->ID());
+
+    const OctaneGUI::VertexBuffer& Buffer = Window->GetBuffer();
+    bool Found = false;
+    for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
+    {
+        VERIFYF(Command.TextureID() != PreviousID, "Command uses the replaced texture %u\n", PreviousID);
+        Found = Found || Command.TextureID() == Font->ID();
+    }
+    VERIFY(Found);
+
+    bool FoundUV = false;
+    for (const OctaneGUI::Vertex& Vertex : Buffer.GetVertices())
+    {
+        FoundUV = FoundUV || Vertex.TexCoords == TexCoords.Min;
+    }
+
+    return FoundUV;
+})
+
+TEST_CASE(CachePaintThemeLoaded,
+{
+    OctaneGUI::ControlList List;
+    Load(Application,
+        R"({"ID": "Cached", "Type": "VerticalContainer", "CachePaint": true, "Controls": [
+            {"Type": "Text", "Text": "Text"}]})",
+        List);
+
+    const std::shared_ptr<OctaneGUI::Container> Cached = List.To<OctaneGUI::Container>("Cached");
+    const std::shared_ptr<OctaneGUI::Theme> Theme = Application.GetTheme();
+    Application.Update();
+
+    // The container is painted before the layout that follows loading the theme, so only the
+    // theme's generation tells the cache that the text color changed.
+    const OctaneGUI::Color Previous = Theme->Get(OctaneGUI::ThemeProperties::Text).ToColor();
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Theme);
+    Cached->OnPaint(Brush);
+    Theme->Load(OctaneGUI::Json::Parse(R"({"Text": [1, 2, 3, 255]})"));
+    Buffer.Clear();
+    Cached->OnPaint(Brush);
+
+    bool Found = false;
+    for (const OctaneGUI::Vertex& Vertex : Buffer.GetVertices())
+    {
+        Found = Found || Vertex.Col == OctaneGUI::Color(1, 2, 3, 255);
+    }
+
+    OctaneGUI::Json Restore { OctaneGUI::Json::Type::Object };
+    OctaneGUI::Json Text { OctaneGUI::Json::Type::Array };
+    Text.Push((float)Previous.R);
+    Text.Push((float)Previous.G);
+    Text.Push((float)Previous.B);
+    Text.Push((float)Previous.A);
+    Restore["Text"] = std::move(Text);
+    Theme->Load(Restore);
+    Application.Update();
+
+    return Found;
+})
+
+TEST_CASE(CachePaintInvalidate,
+{
+    OctaneGUI::ControlList List;
+    Load(Application,
+        R"({"ID": "Cached", "Type": "VerticalContainer", "CachePaint": true, "Controls": [
+            {"ID": "Text", "Type": "Text", "Text": "Text"}]})",
+        List);
+
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const std::shared_ptr<OctaneGUI::Text> Text = List.To<OctaneGUI::Text>("Cached.Text");
+    Application.Update();
+
+    const uint32_t VertexCount = Window->GetBuffer().GetVertexCount();
+
+    Text->SetText("Some Longer Text");
+    Application.Update();
+
+    return Window->GetBuffer().GetVertexCount() > VertexCount;
+})
+
 )
 
 }
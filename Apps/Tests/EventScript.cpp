@@ -0,0 +1,92 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+namespace Tests
+{
+
+TEST_SUITE(EventScript,
+
+TEST_CASE(Wait,
+{
+    const OctaneGUI::Json Root = OctaneGUI::Json::Parse(R"({"Events": [
+        {"Type": "MouseMoved", "Position": [10, 20]},
+        {"Type": "MousePressed", "Button": "Right", "Position": [10, 20]},
+        {"Type": "Wait", "Frames": 3},
+        {"Type": "KeyPressed", "Key": "Enter", "Window": "Other"},
+        {"Type": "Wait"}
+    ]})");
+
+    uint64_t Frame = 1;
+    std::vector<OctaneGUI::EventScript::Item> Items;
+    VERIFY(OctaneGUI::EventScript::Parse(Root, Frame, Items))
+    VERIFY(Items.size() == 3)
+    VERIFY((Items[0].Frame == 1 && Items[0].Window == "Main" && Items[0].Value.GetType() == OctaneGUI::Event::Type::MouseMoved))
+    VERIFY(Items[0].Value.GetData().m_MouseMove.m_Position == OctaneGUI::Vector2(10.0f, 20.0f))
+    VERIFY((Items[1].Frame == 1 && Items[1].Value.GetData().m_MouseButton.m_Button == OctaneGUI::Mouse::Button::Right))
+    VERIFY((Items[2].Frame == 4 && Items[2].Window == "Other" && Items[2].Value.GetData().m_Key.m_Code == OctaneGUI::Keyboard::Key::Enter))
+    return Frame == 5;
+})
+
+TEST_CASE(Repeat,
+{
+    const OctaneGUI::Json Root = OctaneGUI::Json::Parse(R"({"Events": [
+        {"Type": "Repeat", "Count": 3, "Events": [
+            {"Type": "Text", "Text": "ab"},
+            {"Type": "Wait", "Frames": 2}
+        ]}
+    ]})");
+
+    uint64_t Frame = 0;
+    std::vector<OctaneGUI::EventScript::Item> Items;
+    VERIFY(OctaneGUI::EventScript::Parse(Root, Frame, Items))
+    VERIFY(Items.size() == 6)
+    for (size_t I = 0; I < Items.size(); I++)
+    {
+        VERIFY(Items[I].Frame == (I / 2) * 2)
+        VERIFYF(Items[I].Value.GetData().m_Text.Code == (I % 2 == 0 ? 'a' : 'b'), "Unexpected character at %zu.", I)
+    }
+    return Frame == 6;
+})
+
+TEST_CASE(UnknownType,
+{
+    const OctaneGUI::Json Root = OctaneGUI::Json::Parse(R"({"Events": [
+        {"Type": "Unknown"},
+        {"Type": "KeyReleased", "Key": "Tab"}
+    ]})");
+
+    uint64_t Frame = 0;
+    std::vector<OctaneGUI::EventScript::Item> Items;
+    VERIFY(!OctaneGUI::EventScript::Parse(Root, Frame, Items))
+    return Items.size() == 1 && Items[0].Value.GetType() == OctaneGUI::Event::Type::KeyReleased;
+})
+
+)
+
+}
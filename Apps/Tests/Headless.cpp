@@ -0,0 +1,105 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "Frontend.h"
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+#include "Windowing/Headless/Interface.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+namespace Tests
+{
+
+typedef std::unordered_map<std::string, OctaneGUI::ControlList> WindowControlsMap;
+
+// An empty value clears the variable on every platform as far as the headless frontend is concerned.
+static void SetEnvironment(const char* Name, const char* Value)
+{
+#if defined(_WIN32)
+    _putenv_s(Name, Value);
+#else
+    setenv(Name, Value, 1);
+#endif
+}
+
+TEST_SUITE(Headless,
+
+TEST_CASE(RunScript,
+{
+    // Types into the text input and removes the last character. The frame limit then closes the
+    // main window, which returns from Run.
+    {
+        std::ofstream File("HeadlessScript.json");
+        File << R"({"Events": [
+            {"Type": "MouseMoved", "Position": [20, 10]},
+            {"Type": "Wait", "Frames": 2},
+            {"Type": "MousePressed", "Position": [20, 10], "Button": "Left"},
+            {"Type": "MouseReleased", "Position": [20, 10], "Button": "Left"},
+            {"Type": "Wait"},
+            {"Type": "Text", "Text": "hello"},
+            {"Type": "KeyPressed", "Key": "Backspace"},
+            {"Type": "KeyReleased", "Key": "Backspace"}]})";
+    }
+
+    SetEnvironment("OCTANEGUI_SCRIPT", "HeadlessScript.json");
+    SetEnvironment("OCTANEGUI_FRAME_LIMIT", "20");
+
+    std::string Typed;
+    int Result = -1;
+    {
+        OctaneGUI::Application Scripted;
+        Frontend::Initialize(Scripted);
+        SetEnvironment("OCTANEGUI_SCRIPT", "");
+        SetEnvironment("OCTANEGUI_FRAME_LIMIT", "");
+        std::remove("HeadlessScript.json");
+
+        WindowControlsMap WindowControls;
+        VERIFY(Scripted.Initialize(R"({
+            "Theme": {"FontPath": "Resources/Roboto-Regular.ttf", "FontSize": 18},
+            "Windows": {"Main": {"Title": "Headless", "Width": 300, "Height": 200, "Body": {"Controls": [
+                {"ID": "Input", "Type": "TextInput"}]}}}
+        })", WindowControls));
+
+        WindowControls["Main"].To<OctaneGUI::TextInput>("Input")->SetOnTextChanged([&Typed](std::shared_ptr<OctaneGUI::TextInput> Input) -> void
+            {
+                Typed = OctaneGUI::String::ToMultiByte(Input->GetString());
+            });
+
+        Result = Scripted.Run();
+    }
+
+    VERIFYF(Frontend::Windowing::FrameCount() == 21, "Ran %llu frames\n", (unsigned long long)Frontend::Windowing::FrameCount());
+    VERIFY(Frontend::Windowing::ScriptFinished());
+    VERIFYF(Typed == "hell", "Typed '%s'\n", Typed.c_str());
+    return Result == 0;
+})
+
+)
+
+}
@@ -213,6 +213,16 @@ TEST_CASE(CommaInString,
     return std::string(Root["Text"].String()) == "Hello, World";
 })
 
+TEST_CASE(ToStringNoTrailingComma,
+{
+    OctaneGUI::Json Root = OctaneGUI::Json::Parse(R"({"A": 1, "B": {"C": [1, 2]}})");
+    const std::string Result = Root.ToString();
+    VERIFYF(Result.find(",}") == std::string::npos && Result.find(", }") == std::string::npos, "Trailing comma found in '%s'.\n", Result.c_str());
+    bool IsError = false;
+    OctaneGUI::Json Parsed = OctaneGUI::Json::Parse(Root.ToStringPretty().c_str(), IsError);
+    return !IsError && Parsed == Root;
+})
+
 TEST_CASE(InvalidKey_NoStartingQuote,
 {
     bool IsError = false;
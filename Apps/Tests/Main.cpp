@@ -47,6 +47,10 @@ uint32_t OnLoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_
     return ++TextureID;
 }
 
+void OnUpdateTexture(uint32_t ID, const std::vector<uint8_t>& Data, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
+{
+}
+
 void OnExit()
 {
 }
@@ -59,6 +63,7 @@ int main(int argc, char** argv)
         .SetOnEvent(OnEvent)
         .SetOnPaint(OnPaint)
         .SetOnLoadTexture(OnLoadTexture)
+        .SetOnUpdateTexture(OnUpdateTexture)
         .SetOnExit(OnExit);
     
     const char* Json = 
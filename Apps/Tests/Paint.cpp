@@ -0,0 +1,171 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <cmath>
+
+namespace Tests
+{
+
+TEST_SUITE(Paint,
+
+TEST_CASE(RoundedRectangle,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Application.GetTheme());
+    Brush.RectangleRounded({ 10.0f, 20.0f, 110.0f, 60.0f }, OctaneGUI::Color::White, { 8.0f, 8.0f, 8.0f, 8.0f });
+
+    VERIFY(Buffer.Commands().size() == 1);
+    VERIFYF(Buffer.Commands()[0].IndexCount() == Buffer.GetIndexCount(), "Command expects %u indices, buffer has %u\n", Buffer.Commands()[0].IndexCount(), Buffer.GetIndexCount());
+    for (uint32_t Index : Buffer.GetIndices())
+    {
+        VERIFYF(Index < Buffer.GetVertexCount(), "Index %u is out of range of %u vertices\n", Index, Buffer.GetVertexCount());
+    }
+
+    // The first arc comes after the five rectangles and fans out from the corner's center.
+    const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
+    const std::vector<uint32_t>& Indices = Buffer.GetIndices();
+    VERIFY(Indices[30] == 20 && Vertices[20].Position == OctaneGUI::Vector2(18.0f, 28.0f));
+    return Vertices[21].Position == OctaneGUI::Vector2(10.0f, 28.0f) && Vertices[Indices[Indices.size() - 1]].Position == OctaneGUI::Vector2(10.0f, 52.0f);
+})
+
+TEST_CASE(AdaptiveSteps,
+{
+    OctaneGUI::VertexBuffer Small;
+    OctaneGUI::Paint SmallBrush(Small, Application.GetTheme());
+    SmallBrush.Circle({ 50.0f, 50.0f }, 4.0f, OctaneGUI::Color::White);
+
+    OctaneGUI::VertexBuffer Large;
+    OctaneGUI::Paint LargeBrush(Large, Application.GetTheme());
+    LargeBrush.Circle({ 50.0f, 50.0f }, 200.0f, OctaneGUI::Color::White);
+
+    VERIFYF(Small.GetVertexCount() < Large.GetVertexCount(), "Expected fewer vertices for a small circle: %u >= %u\n", Small.GetVertexCount(), Large.GetVertexCount());
+    VERIFY(Small.Commands()[0].IndexCount() == Small.GetIndexCount() && Large.Commands()[0].IndexCount() == Large.GetIndexCount());
+
+    // An explicit step count is always used.
+    OctaneGUI::VertexBuffer Fixed;
+    OctaneGUI::Paint FixedBrush(Fixed, Application.GetTheme());
+    FixedBrush.Circle({ 50.0f, 50.0f }, 4.0f, OctaneGUI::Color::White, 16);
+    return Fixed.GetVertexCount() == 18 && Fixed.GetIndexCount() == 48;
+})
+
+TEST_CASE(ArcEndpoints,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Application.GetTheme());
+    Brush.Arc({ 0.0f, 0.0f }, 10.0f, 0.0f, 90.0f, OctaneGUI::Color::White);
+
+    const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
+    VERIFY(Vertices[0].Position == OctaneGUI::Vector2(0.0f, 0.0f));
+    return Vertices[1].Position == OctaneGUI::Vector2(10.0f, 0.0f) && Vertices.back().Position == OctaneGUI::Vector2(0.0f, 10.0f);
+})
+
+TEST_CASE(StepsClamped,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Application.GetTheme());
+    Brush.Circle({ 50.0f, 50.0f }, 4.0f, OctaneGUI::Color::White, 1000);
+    return Buffer.GetVertexCount() == 66 && Buffer.GetIndexCount() == 192;
+})
+
+TEST_CASE(ArcBetweenSteps,
+{
+    // With 12 steps, the points of the circle are 30 degrees apart. The points between the
+    // angles come from the circle while the ends are placed on the angles.
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Application.GetTheme());
+    Brush.Arc({ 0.0f, 0.0f }, 100.0f, 10.0f, 100.0f, OctaneGUI::Color::White, 12);
+
+    const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
+    VERIFYF(Vertices.size() == 6, "Expected 6 vertices, got %zu\n", Vertices.size());
+    VERIFY(Vertices[1].Position == OctaneGUI::Vector2(98.0f, 17.0f) && Vertices[2].Position == OctaneGUI::Vector2(87.0f, 50.0f));
+    return Vertices[5].Position == OctaneGUI::Vector2(-17.0f, 98.0f) && Buffer.GetIndexCount() == 12;
+})
+
+TEST_CASE(FeatheredCircle,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Application.GetTheme());
+    VERIFY(!Brush.AntiAliased());
+    Brush.SetAntiAliased(true);
+    Brush.Circle({ 50.0f, 50.0f }, 8.0f, OctaneGUI::Color::White);
+
+    // A center, then an opaque inner and transparent outer vertex for each point.
+    const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
+    VERIFYF(Vertices.size() < 66, "Expected fewer vertices than a 64 step circle, got %zu\n", Vertices.size());
+    VERIFY(Vertices.size() % 2 == 1 && Buffer.Commands()[0].IndexCount() == Buffer.GetIndexCount());
+    for (size_t I = 1; I < Vertices.size(); I += 2)
+    {
+        const float Inner = (Vertices[I].Position - OctaneGUI::Vector2(50.0f, 50.0f)).Length();
+        const float Outer = (Vertices[I + 1].Position - OctaneGUI::Vector2(50.0f, 50.0f)).Length();
+        VERIFYF(std::abs(Inner - 7.5f) < 0.01f && std::abs(Outer - 8.5f) < 0.01f, "Point %zu is at %.2f and %.2f\n", I, Inner, Outer);
+        VERIFY(Vertices[I].Col.A == 255 && Vertices[I + 1].Col.A == 0);
+    }
+
+    for (uint32_t Index : Buffer.GetIndices())
+    {
+        VERIFY(Index < Buffer.GetVertexCount());
+    }
+    return true;
+})
+
+TEST_CASE(FeatheredShapes,
+{
+    const std::shared_ptr<OctaneGUI::Theme> Theme = std::make_shared<OctaneGUI::Theme>();
+    Theme->Load(OctaneGUI::Json::Parse(R"({"FontPath": "Resources/Roboto-Regular.ttf", "FontSize": 18, "AntiAliasing": true})"));
+
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Theme);
+    VERIFY(Brush.AntiAliased());
+
+    Brush.Line({ 0.0f, 10.0f }, { 20.0f, 10.0f }, OctaneGUI::Color::White, 1.0f);
+    VERIFY(Buffer.GetVertexCount() == 8 && Buffer.GetIndexCount() == 18);
+    VERIFY(Buffer.GetVertices()[0].Position == OctaneGUI::Vector2(0.0f, 11.0f) && Buffer.GetVertices()[0].Col.A == 0);
+
+    Brush.RectangleRounded({ 10.0f, 20.0f, 110.0f, 60.0f }, OctaneGUI::Color::White, { 8.0f, 0.0f, 8.0f, 0.0f });
+    Brush.Rectangle3DRounded({ 10.0f, 70.0f, 110.0f, 110.0f }, { 4.0f, 4.0f, 4.0f, 4.0f }, OctaneGUI::Color::White, OctaneGUI::Color::White, OctaneGUI::Color::Black);
+    Brush.ArcOutline({ 50.0f, 50.0f }, 10.0f, 0.0f, 90.0f, OctaneGUI::Color::White, 2.0f);
+    Brush.CircleOutline({ 50.0f, 50.0f }, 10.0f, OctaneGUI::Color::White);
+
+    uint32_t IndexCount = 0;
+    for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
+    {
+        IndexCount += Command.IndexCount();
+    }
+    VERIFYF(IndexCount == Buffer.GetIndexCount(), "Commands expect %u indices, buffer has %u\n", IndexCount, Buffer.GetIndexCount());
+
+    for (uint32_t Index : Buffer.GetIndices())
+    {
+        VERIFY(Index < Buffer.GetVertexCount());
+    }
+    return true;
+})
+
+)
+
+}
@@ -0,0 +1,162 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#if TOOLS
+
+#include "OctaneGUI/Profiler.h"
+
+namespace Tests
+{
+
+// Must match the ring buffer sizes in Tools/Profiler.cpp.
+static const uint64_t FrameCapacity = 1 << 14;
+static const uint64_t RecordCapacity = 1 << 18;
+
+// Records a frame with a group holding two samples and a nested group with a single sample.
+static void RecordFrame()
+{
+    OctaneGUI::Tools::Profiler& Profiler = OctaneGUI::Tools::Profiler::Get();
+    static const OctaneGUI::Tools::Profiler::ID Outer = Profiler.Register("Outer");
+    static const OctaneGUI::Tools::Profiler::ID Inner = Profiler.Register("Inner");
+    static const OctaneGUI::Tools::Profiler::ID Leaf = Profiler.Register("Leaf");
+
+    OctaneGUI::Tools::Profiler::Frame Frame(true);
+    OctaneGUI::Tools::Profiler::Sample OuterSample(Outer, true);
+    {
+        OctaneGUI::Tools::Profiler::Sample LeafSample(Leaf, false);
+    }
+    {
+        OctaneGUI::Tools::Profiler::Sample LeafSample(Leaf, false);
+    }
+    {
+        OctaneGUI::Tools::Profiler::Sample InnerSample(Inner, true);
+        OctaneGUI::Tools::Profiler::Sample LeafSample(Leaf, false);
+    }
+}
+
+// Verifies the event tree built from a frame recorded with RecordFrame.
+static bool IsRecordedFrame(const OctaneGUI::Tools::Profiler::Frame& Frame)
+{
+    const std::vector<OctaneGUI::Tools::Profiler::Event>& Events = Frame.Events();
+    if (Events.size() != 1 || std::string(Events[0].Name()) != "Outer")
+    {
+        return false;
+    }
+
+    const std::vector<OctaneGUI::Tools::Profiler::Event>& Children = Events[0].Events();
+    if (Children.size() != 2)
+    {
+        return false;
+    }
+
+    const OctaneGUI::Tools::Profiler::Event& Leaves = Children[0];
+    const OctaneGUI::Tools::Profiler::Event& Inner = Children[1];
+    return std::string(Leaves.Name()) == "Leaf"
+        && Leaves.ExclusiveCount() == 2
+        && std::string(Inner.Name()) == "Inner"
+        && Inner.Events().size() == 1
+        && std::string(Inner.Events()[0].Name()) == "Leaf"
+        && Inner.Events()[0].Events().empty();
+}
+
+TEST_SUITE(Profiler,
+
+TEST_CASE(NestedGroups,
+{
+    OctaneGUI::Tools::Profiler& Profiler = OctaneGUI::Tools::Profiler::Get();
+    Profiler.Enable();
+    RecordFrame();
+    RecordFrame();
+    Profiler.Disable();
+
+    VERIFYF(Profiler.Frames().size() == 2, "Expected 2 frames but found %zu.\n", Profiler.Frames().size());
+    VERIFYF(std::string(Profiler.Frames()[0].Events()[0].Name()) == "Outer", "Root group is incorrect.\n");
+    return IsRecordedFrame(Profiler.Frames()[0]) && IsRecordedFrame(Profiler.Frames()[1]);
+})
+
+TEST_CASE(FrameRingWrap,
+{
+    OctaneGUI::Tools::Profiler& Profiler = OctaneGUI::Tools::Profiler::Get();
+    Profiler.Enable();
+    for (uint64_t I = 0; I < FrameCapacity + 100; I++)
+    {
+        RecordFrame();
+    }
+    Profiler.Disable();
+
+    const std::vector<OctaneGUI::Tools::Profiler::Frame>& Frames = Profiler.Frames();
+    VERIFYF(Frames.size() == FrameCapacity, "Expected %d frames but found %zu.\n", (int)FrameCapacity, Frames.size());
+    for (size_t I = 0; I < Frames.size(); I++)
+    {
+        VERIFYF(IsRecordedFrame(Frames[I]), "Frame %zu was not rebuilt correctly.\n", I);
+    }
+
+    return true;
+})
+
+TEST_CASE(RecordRingWrap,
+{
+    OctaneGUI::Tools::Profiler& Profiler = OctaneGUI::Tools::Profiler::Get();
+    const OctaneGUI::Tools::Profiler::ID Large = Profiler.Register("Large");
+    const OctaneGUI::Tools::Profiler::ID Leaf = Profiler.Register("Leaf");
+
+    Profiler.Enable();
+    RecordFrame();
+
+    // This frame holds more records than the ring buffer. Its own records along with the
+    // previous frame's are overwritten, so neither can be rebuilt.
+    {
+        OctaneGUI::Tools::Profiler::Frame Frame(true);
+        OctaneGUI::Tools::Profiler::Sample LargeSample(Large, true);
+        for (uint64_t I = 0; I < RecordCapacity + 10; I++)
+        {
+            OctaneGUI::Tools::Profiler::Sample LeafSample(Leaf, false);
+        }
+    }
+
+    RecordFrame();
+    RecordFrame();
+    RecordFrame();
+    Profiler.Disable();
+
+    const std::vector<OctaneGUI::Tools::Profiler::Frame>& Frames = Profiler.Frames();
+    VERIFYF(Frames.size() == 3, "Expected 3 frames but found %zu.\n", Frames.size());
+    for (size_t I = 0; I < Frames.size(); I++)
+    {
+        VERIFYF(IsRecordedFrame(Frames[I]), "Frame %zu was not rebuilt correctly.\n", I);
+    }
+
+    return true;
+})
+
+)
+
+}
+
+#endif
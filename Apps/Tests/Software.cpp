@@ -0,0 +1,297 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "Rendering/Rendering.h"
+#include "Rendering/Software/Interface.h"
+#include "TestSuite.h"
+
+namespace Tests
+{
+
+static uint32_t Pack(uint32_t R, uint32_t G, uint32_t B, uint32_t A)
+{
+    return R | (G << 8) | (B << 16) | (A << 24);
+}
+
+// The color the software renderer clears the framebuffer with.
+static const uint32_t Clear = Pack(0, 0, 0, 255);
+
+static void AddBox(OctaneGUI::VertexBuffer& Buffer, const OctaneGUI::Rect& Bounds, const OctaneGUI::Color& Col, uint32_t TextureID = 0, const OctaneGUI::Rect& Clip = {})
+{
+    Buffer.PushCommand(6, TextureID, Clip);
+    Buffer.AddVertex(Bounds.Min, { 0.0f, 0.0f }, Col);
+    Buffer.AddVertex({ Bounds.Max.X, Bounds.Min.Y }, { 1.0f, 0.0f }, Col);
+    Buffer.AddVertex(Bounds.Max, { 1.0f, 1.0f }, Col);
+    Buffer.AddVertex({ Bounds.Min.X, Bounds.Max.Y }, { 0.0f, 1.0f }, Col);
+    Buffer.AddIndex(0);
+    Buffer.AddIndex(1);
+    Buffer.AddIndex(2);
+    Buffer.AddIndex(0);
+    Buffer.AddIndex(2);
+    Buffer.AddIndex(3);
+}
+
+// Each triangle is a command of its own so that two of them are never rasterized as a box.
+static void AddTriangle(OctaneGUI::VertexBuffer& Buffer, const OctaneGUI::Vector2& A, const OctaneGUI::Vector2& B, const OctaneGUI::Vector2& C, const OctaneGUI::Color& Col, const OctaneGUI::Rect& Clip = {})
+{
+    Buffer.BreakBatch();
+    Buffer.PushCommand(3, 0, Clip);
+    Buffer.AddVertex(A, Col);
+    Buffer.AddVertex(B, Col);
+    Buffer.AddVertex(C, Col);
+    Buffer.AddIndex(0);
+    Buffer.AddIndex(1);
+    Buffer.AddIndex(2);
+}
+
+// Other suites resize the window, so every frame is painted at the same size.
+static Frontend::Rendering::Framebuffer Render(OctaneGUI::Application& Application, const OctaneGUI::VertexBuffer& Buffer)
+{
+    OctaneGUI::Window* Window = Application.GetMainWindow().get();
+    Window->SetSize({ 1280.0f, 720.0f });
+    Frontend::Rendering::Paint(Window, Buffer);
+    return Frontend::Rendering::GetFramebuffer(Window);
+}
+
+static uint32_t Pixel(const Frontend::Rendering::Framebuffer& Framebuffer, uint32_t X, uint32_t Y)
+{
+    return Framebuffer.Pixels[Y * Framebuffer.Width + X];
+}
+
+static std::vector<uint32_t> Copy(const Frontend::Rendering::Framebuffer& Framebuffer)
+{
+    return std::vector<uint32_t>(Framebuffer.Pixels, Framebuffer.Pixels + (size_t)Framebuffer.Width * Framebuffer.Height);
+}
+
+TEST_SUITE(Software,
+
+TEST_CASE(Framebuffer,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    const Frontend::Rendering::Framebuffer Framebuffer = Render(Application, Buffer);
+    VERIFYF((Framebuffer.Width == 1280 && Framebuffer.Height == 720),
+        "Framebuffer is %ux%u\n", Framebuffer.Width, Framebuffer.Height);
+    return Pixel(Framebuffer, 0, 0) == Clear && Pixel(Framebuffer, Framebuffer.Width - 1, Framebuffer.Height - 1) == Clear;
+})
+
+TEST_CASE(EdgeRules,
+{
+    // Two quads with edges through pixel centers, each split along its diagonal into two translucent
+    // triangles. A pixel blended twice or missed along any edge shows up as a different color.
+    OctaneGUI::VertexBuffer Buffer;
+    const OctaneGUI::Color Red(255, 0, 0, 128);
+    const OctaneGUI::Color Blue(0, 0, 255, 128);
+    for (float X = 0.5f; X < 16.0f; X += 8.0f)
+    {
+        AddTriangle(Buffer, { X, 0.5f }, { X + 8.0f, 0.5f }, { X + 8.0f, 8.5f }, Red);
+        AddTriangle(Buffer, { X, 0.5f }, { X + 8.0f, 8.5f }, { X, 8.5f }, Blue);
+    }
+
+    const Frontend::Rendering::Framebuffer Framebuffer = Render(Application, Buffer);
+    const uint32_t OverRed = Pack(128, 0, 0, 255);
+    const uint32_t OverBlue = Pack(0, 0, 128, 255);
+
+    // Pixel centers on the left and top edges are covered while those on the right and bottom are not.
+    for (uint32_t Y = 0; Y < 9; Y++)
+    {
+        for (uint32_t X = 0; X < 17; X++)
+        {
+            const uint32_t Actual = Pixel(Framebuffer, X, Y);
+            const uint32_t Column = X % 8;
+            if (X == 16 || Y == 8)
+            {
+                VERIFYF(Actual == Clear, "Pixel %u,%u outside of the quads is 0x%08X\n", X, Y, Actual);
+            }
+            else if (Column == Y)
+            {
+                VERIFYF((Actual == OverRed || Actual == OverBlue), "Pixel %u,%u on a diagonal is 0x%08X\n", X, Y, Actual);
+                VERIFYF(Actual == Pixel(Framebuffer, Y, Y), "Pixel %u,%u has a different owner than %u,%u\n", X, Y, Y, Y);
+            }
+            else
+            {
+                const uint32_t Expected = Column > Y ? OverRed : OverBlue;
+                VERIFYF(Actual == Expected, "Pixel %u,%u is 0x%08X instead of 0x%08X\n", X, Y, Actual, Expected);
+            }
+        }
+    }
+
+    return true;
+})
+
+TEST_CASE(Scissor,
+{
+    // The box covers four tiles, and its clip crosses the corner they share.
+    OctaneGUI::VertexBuffer Buffer;
+    AddBox(Buffer, OctaneGUI::Rect(0.0f, 0.0f, 128.0f, 128.0f), OctaneGUI::Color(0, 255, 0, 255), 0, OctaneGUI::Rect(60.0f, 58.0f, 70.0f, 66.0f));
+    AddTriangle(Buffer, { 0.0f, 100.0f }, { 40.0f, 100.0f }, { 0.0f, 140.0f }, OctaneGUI::Color(0, 0, 255, 255), OctaneGUI::Rect(10.0f, 90.0f, 20.0f, 130.0f));
+
+    const Frontend::Rendering::Framebuffer Framebuffer = Render(Application, Buffer);
+    const uint32_t Green = Pack(0, 255, 0, 255);
+    const uint32_t Blue = Pack(0, 0, 255, 255);
+    for (uint32_t Y = 50; Y < 75; Y++)
+    {
+        for (uint32_t X = 50; X < 75; X++)
+        {
+            const bool Inside = X >= 60 && X < 70 && Y >= 58 && Y < 66;
+            const uint32_t Expected = Inside ? Green : Clear;
+            VERIFYF(Pixel(Framebuffer, X, Y) == Expected, "Pixel %u,%u is 0x%08X instead of 0x%08X\n", X, Y, Pixel(Framebuffer, X, Y), Expected);
+        }
+    }
+
+    // The clip cuts off the left and bottom edges of the triangle. Pixel centers on its hypotenuse,
+    // where X + Y + 1 = 140, are left to the edge rules.
+    for (uint32_t Y = 95; Y < 135; Y++)
+    {
+        for (uint32_t X = 5; X < 25; X++)
+        {
+            if (X + Y + 1 == 140)
+            {
+                continue;
+            }
+
+            const bool Inside = X >= 10 && X < 20 && Y >= 100 && Y < 130 && (float)X + (float)Y + 1.0f < 140.0f;
+            const uint32_t Expected = Inside ? Blue : Clear;
+            VERIFYF(Pixel(Framebuffer, X, Y) == Expected, "Pixel %u,%u is 0x%08X instead of 0x%08X\n", X, Y, Pixel(Framebuffer, X, Y), Expected);
+        }
+    }
+
+    return true;
+})
+
+TEST_CASE(TextureSampling,
+{
+    // Red, green on the top row and blue, white on the bottom row.
+    const std::vector<uint8_t> Data({
+        255, 0, 0, 255, 0, 255, 0, 255,
+        0, 0, 255, 255, 255, 255, 255, 255 });
+    const uint32_t ID = Frontend::Rendering::LoadTexture(Data, 2, 2);
+
+    OctaneGUI::VertexBuffer Buffer;
+    AddBox(Buffer, OctaneGUI::Rect(0.0f, 0.0f, 2.0f, 2.0f), OctaneGUI::Color::White, ID);
+    AddBox(Buffer, OctaneGUI::Rect(4.0f, 0.0f, 8.0f, 4.0f), OctaneGUI::Color::White, ID);
+    AddBox(Buffer, OctaneGUI::Rect(10.0f, 0.0f, 12.0f, 2.0f), OctaneGUI::Color(128, 128, 128, 255), ID);
+
+    const Frontend::Rendering::Framebuffer Framebuffer = Render(Application, Buffer);
+    Frontend::Rendering::UnloadTexture(ID);
+
+    // Each pixel center samples a single texel when the texture is drawn at its size.
+    VERIFY(Pixel(Framebuffer, 0, 0) == Pack(255, 0, 0, 255));
+    VERIFY(Pixel(Framebuffer, 1, 0) == Pack(0, 255, 0, 255));
+    VERIFY(Pixel(Framebuffer, 0, 1) == Pack(0, 0, 255, 255));
+    VERIFY(Pixel(Framebuffer, 1, 1) == Pack(255, 255, 255, 255));
+
+    // At twice the size, the first pixel of each row is clamped to the edge and the second is a
+    // quarter of the way to the next texel.
+    VERIFY(Pixel(Framebuffer, 4, 0) == Pack(255, 0, 0, 255));
+    VERIFYF(Pixel(Framebuffer, 5, 0) == Pack(191, 64, 0, 255), "Filtered pixel is 0x%08X\n", Pixel(Framebuffer, 5, 0));
+    VERIFYF(Pixel(Framebuffer, 5, 1) == Pack(159, 64, 64, 255), "Filtered pixel is 0x%08X\n", Pixel(Framebuffer, 5, 1));
+
+    // The vertex color is multiplied with each texel.
+    return Pixel(Framebuffer, 10, 0) == Pack(128, 0, 0, 255) && Pixel(Framebuffer, 11, 1) == Pack(128, 128, 128, 255);
+})
+
+TEST_CASE(AlphaBlending,
+{
+    // Rows are seven pixels wide so both the vectorized and remaining pixels of a span are blended.
+    const std::vector<uint8_t> Data({ 255, 255, 255, 128 });
+    const uint32_t ID = Frontend::Rendering::LoadTexture(Data, 1, 1);
+
+    OctaneGUI::VertexBuffer Buffer;
+    AddBox(Buffer, OctaneGUI::Rect(0.0f, 0.0f, 7.0f, 2.0f), OctaneGUI::Color::White);
+    AddBox(Buffer, OctaneGUI::Rect(0.0f, 0.0f, 7.0f, 2.0f), OctaneGUI::Color(255, 0, 0, 128));
+    AddBox(Buffer, OctaneGUI::Rect(0.0f, 4.0f, 7.0f, 6.0f), OctaneGUI::Color::White, ID);
+    AddBox(Buffer, OctaneGUI::Rect(0.0f, 8.0f, 7.0f, 10.0f), OctaneGUI::Color(255, 0, 0, 0));
+
+    const Frontend::Rendering::Framebuffer Framebuffer = Render(Application, Buffer);
+    Frontend::Rendering::UnloadTexture(ID);
+
+    for (uint32_t Y = 0; Y < 10; Y++)
+    {
+        for (uint32_t X = 0; X < 8; X++)
+        {
+            uint32_t Expected = Clear;
+            if (X < 7 && Y < 2)
+            {
+                Expected = Pack(255, 127, 127, 255);
+            }
+            else if (X < 7 && Y >= 4 && Y < 6)
+            {
+                Expected = Pack(128, 128, 128, 255);
+            }
+
+            VERIFYF(Pixel(Framebuffer, X, Y) == Expected, "Pixel %u,%u is 0x%08X instead of 0x%08X\n", X, Y, Pixel(Framebuffer, X, Y), Expected);
+        }
+    }
+
+    return true;
+})
+
+
+TEST_CASE(ThreadCountDeterminism,
+{
+    // Enough overlapping translucent triangles to be rasterized on every thread, where each pixel
+    // depends on the order that the triangles covering it are blended in.
+    OctaneGUI::VertexBuffer Buffer;
+    uint32_t Seed = 12345;
+    const auto Random = [&Seed](uint32_t Range) -> float
+    {
+        Seed = Seed * 1664525u + 1013904223u;
+        return (float)((Seed >> 8) % Range);
+    };
+
+    for (int I = 0; I < 2000; I++)
+    {
+        const OctaneGUI::Vector2 Origin(Random(600), Random(400));
+        const OctaneGUI::Color Col((uint8_t)Random(256), (uint8_t)Random(256), (uint8_t)Random(256), (uint8_t)Random(256));
+        AddTriangle(Buffer, Origin, Origin + OctaneGUI::Vector2(Random(120), Random(40)), Origin + OctaneGUI::Vector2(Random(40), Random(120)), Col);
+    }
+
+    // The same two boxes blended in the opposite order give a different color.
+    AddBox(Buffer, OctaneGUI::Rect(700.0f, 500.0f, 800.0f, 600.0f), OctaneGUI::Color(255, 0, 0, 128));
+    AddBox(Buffer, OctaneGUI::Rect(700.0f, 500.0f, 800.0f, 600.0f), OctaneGUI::Color(0, 0, 255, 128));
+
+    Frontend::Rendering::SetThreadCount(1);
+    const std::vector<uint32_t> Single = Copy(Render(Application, Buffer));
+
+    Frontend::Rendering::SetThreadCount(4);
+    const Frontend::Rendering::Framebuffer Framebuffer = Render(Application, Buffer);
+    const std::vector<uint32_t> Multiple = Copy(Framebuffer);
+    Frontend::Rendering::SetThreadCount(0);
+
+    VERIFY(Single.size() == Multiple.size());
+    for (size_t I = 0; I < Single.size(); I++)
+    {
+        VERIFYF(Single[I] == Multiple[I], "Pixel %zu,%zu is 0x%08X with 4 threads and 0x%08X with 1\n",
+            I % Framebuffer.Width, I / Framebuffer.Width, Multiple[I], Single[I]);
+    }
+
+    return Pixel(Framebuffer, 750, 550) == Pack(64, 0, 128, 255);
+})
+
+)
+
+}
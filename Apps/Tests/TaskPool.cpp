@@ -0,0 +1,81 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+#include <atomic>
+
+namespace Tests
+{
+
+TEST_SUITE(TaskPool,
+
+TEST_CASE(RunAll,
+{
+    std::atomic<uint32_t> Count { 0 };
+    OctaneGUI::TaskPool Pool(4);
+    for (int I = 0; I < 1000; I++)
+    {
+        Pool.Add([&Count]() -> void
+            {
+                Count++;
+            });
+    }
+    Pool.Wait();
+    VERIFYF(Count == 1000, "Expected 1000 tasks to run, got %u\n", Count.load());
+
+    // The pool can be used again after waiting.
+    Pool.Add([&Count]() -> void
+        {
+            Count++;
+        });
+    Pool.Wait();
+    return Count == 1001;
+})
+
+TEST_CASE(ThemeFonts,
+{
+    const std::shared_ptr<OctaneGUI::Font> Default = Application.GetTheme()->GetFont();
+
+    OctaneGUI::Theme Theme;
+    Theme.Load(OctaneGUI::Json::Parse(R"({
+        "FontPath": "Resources/Roboto-Regular.ttf",
+        "FontSize": 18,
+        "Fonts": [{"Size": 24}, {"Size": 12}, {"Size": 18}]
+    })"));
+
+    const std::vector<std::shared_ptr<OctaneGUI::Font>>& Fonts = Theme.Fonts();
+    VERIFYF(Fonts.size() == 3, "Expected 3 fonts, got %zu\n", Fonts.size());
+    VERIFY(Theme.GetFont()->Size() == 18.0f && Fonts[1]->Size() == 24.0f && Fonts[2]->Size() == 12.0f);
+    VERIFY(Theme.GetOrAddFont(nullptr, 24.0f) == Fonts[1]);
+    VERIFY(Fonts[1]->GetTexture() != nullptr && Fonts[2]->GetTexture() != nullptr);
+    return Theme.GetFont()->Measure(U"Well Hello Friends!") == Default->Measure(U"Well Hello Friends!");
+})
+
+)
+
+}
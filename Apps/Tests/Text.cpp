@@ -25,9 +25,14 @@ SOFTWARE.
 */
 
 #include "OctaneGUI/OctaneGUI.h"
+#include "OctaneGUI/Texture.h"
 #include "TestSuite.h"
 #include "Utility.h"
 
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
 namespace Tests
 {
 
@@ -66,6 +71,361 @@ TEST_CASE(Wrap,
     return Text->GetSize().Y > Font->Size();
 })
 
+TEST_CASE(InsertErase,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "VerticalContainer", "Controls": [
+        {"Type": "Text", "ID": "Edited", "Text": "Well\nHello"},
+        {"Type": "Text", "ID": "Expected", "Text": ""}
+    ]})", List);
+
+    const std::shared_ptr<OctaneGUI::Text> Edited = List.To<OctaneGUI::Text>("Edited");
+    const std::shared_ptr<OctaneGUI::Text> Expected = List.To<OctaneGUI::Text>("Expected");
+
+    Edited->Insert(4, U" There Friends\nand");
+    Expected->SetText(U"Well There Friends\nand\nHello");
+    VERIFY(Edited->GetString() == Expected->GetString());
+    VERIFYF(Edited->GetSize() == Expected->GetSize(), "Insert size mismatch: %.2f, %.2f != %.2f, %.2f\n",
+        Edited->GetSize().X, Edited->GetSize().Y, Expected->GetSize().X, Expected->GetSize().Y);
+
+    Edited->Erase(4, 14);
+    Expected->SetText(U"Well\nand\nHello");
+    VERIFY(Edited->GetString() == Expected->GetString());
+    VERIFYF(Edited->GetSize() == Expected->GetSize(), "Erase size mismatch: %.2f, %.2f != %.2f, %.2f\n",
+        Edited->GetSize().X, Edited->GetSize().Y, Expected->GetSize().X, Expected->GetSize().Y);
+
+    Edited->Erase(0, Edited->Length());
+    return Edited->GetSize().X == 0.0f && Edited->GetSize().Y == Expected->LineHeight();
+})
+
+TEST_CASE(MissingGlyph,
+{
+    const std::shared_ptr<OctaneGUI::Font> Font = Application.GetTheme()->GetFont();
+    const OctaneGUI::Vector2 Missing = Font->Measure((uint32_t)127);
+    VERIFY(Font->Measure((uint32_t)0x4E2D) == Missing);
+    return Font->Measure((uint32_t)'A') != Missing && Font->Measure((uint32_t)0xE9).X > 0.0f;
+})
+
+TEST_CASE(DynamicGlyphs,
+{
+    const int Capacity = OctaneGUI::Font::GlyphCapacity();
+    OctaneGUI::Font::SetGlyphCapacity(2);
+    const std::shared_ptr<OctaneGUI::Font> Font = OctaneGUI::Font::Create(Application.GetTheme()->GetFont()->Path(), 18.0f);
+    OctaneGUI::Font::SetGlyphCapacity(Capacity);
+    VERIFY(Font != nullptr);
+
+    const auto UV = [Font](uint32_t CodePoint) -> OctaneGUI::Rect
+    {
+        OctaneGUI::Vector2 Position;
+        OctaneGUI::Rect Vertices;
+        OctaneGUI::Rect TexCoords;
+        Font->Draw(CodePoint, Position, Vertices, TexCoords);
+        return TexCoords;
+    };
+
+    const OctaneGUI::Vector2 Missing = Font->Measure((uint32_t)127);
+    VERIFY(Font->Measure((uint32_t)0x3B1) != Missing);
+    VERIFY(Font->Measure((uint32_t)0x4E2D) == Missing);
+    VERIFYF(Font->DynamicGlyphCount() == 1, "Expected 1 dynamic glyph, got %u\n", Font->DynamicGlyphCount());
+
+    // Alpha is used after beta, so beta is the one replaced by gamma.
+    OctaneGUI::Font::NextFrame();
+    const OctaneGUI::Rect Beta = UV(0x3B2);
+    OctaneGUI::Font::NextFrame();
+    const OctaneGUI::Rect Alpha = UV(0x3B1);
+    const OctaneGUI::Rect Gamma = UV(0x3B3);
+    VERIFYF(Font->DynamicGlyphCount() == 2, "Expected 2 dynamic glyphs, got %u\n", Font->DynamicGlyphCount());
+    VERIFY(Gamma.Min == Beta.Min && UV(0x3B1).Min == Alpha.Min);
+
+    // Beta is loaded again into the cell least recently used, which is gamma's.
+    OctaneGUI::Font::NextFrame();
+    return UV(0x3B2).Min == Gamma.Min;
+})
+
+TEST_CASE(DynamicGlyphsGrow,
+{
+    const int Capacity = OctaneGUI::Font::GlyphCapacity();
+    OctaneGUI::Font::SetGlyphCapacity(2);
+    const std::shared_ptr<OctaneGUI::Font> Font = OctaneGUI::Font::Create(Application.GetTheme()->GetFont()->Path(), 18.0f);
+    OctaneGUI::Font::SetGlyphCapacity(Capacity);
+    VERIFY(Font != nullptr);
+
+    const auto UV = [Font](uint32_t CodePoint) -> OctaneGUI::Rect
+    {
+        OctaneGUI::Vector2 Position;
+        OctaneGUI::Rect Vertices;
+        OctaneGUI::Rect TexCoords;
+        Font->Draw(CodePoint, Position, Vertices, TexCoords);
+        return TexCoords;
+    };
+
+    // Every cell is drawn in the same frame, so none of them can be replaced.
+    OctaneGUI::Font::NextFrame();
+    const OctaneGUI::Vector2 Size = Font->GetTexture()->GetSize();
+    const uint32_t Revision = Font->GlyphRevision();
+    UV(0x3B1);
+    UV(0x3B2);
+    const OctaneGUI::Rect Gamma = UV(0x3B3);
+    VERIFYF(Font->DynamicGlyphCount() == 3, "Expected 3 dynamic glyphs, got %u\n", Font->DynamicGlyphCount());
+    VERIFY(Font->GetTexture()->GetSize().Y > Size.Y && Font->GlyphRevision() != Revision);
+
+    const OctaneGUI::Rect Alpha = UV(0x3B1);
+    const OctaneGUI::Rect Beta = UV(0x3B2);
+    return Alpha.Min != Beta.Min && Beta.Min != Gamma.Min && Alpha.Min != Gamma.Min;
+})
+
+TEST_CASE(DynamicGlyphsGrowUnload,
+{
+    static std::vector<uint32_t> Unloaded;
+
+    const int Capacity = OctaneGUI::Font::GlyphCapacity();
+    OctaneGUI::Font::SetGlyphCapacity(1);
+    const std::shared_ptr<OctaneGUI::Font> Font = OctaneGUI::Font::Create(Application.GetTheme()->GetFont()->Path(), 18.0f);
+    OctaneGUI::Font::SetGlyphCapacity(Capacity);
+    VERIFY(Font != nullptr);
+
+    Application.SetOnUnloadTexture([](uint32_t ID) -> void
+        {
+            Unloaded.push_back(ID);
+        });
+
+    // The replaced texture is still needed by the glyphs drawn this frame.
+    OctaneGUI::Font::NextFrame();
+    Unloaded.clear();
+    const std::shared_ptr<OctaneGUI::Texture> Previous = Font->GetTexture();
+    const uint32_t PreviousID = Previous->GetID();
+    Font->Measure(U"\u03b1\u03b2");
+    const bool UnloadedEarly = !Unloaded.empty();
+    OctaneGUI::Font::NextFrame();
+
+    Application.SetOnUnloadTexture(nullptr);
+
+    VERIFYF(Font->GetTexture() != Previous, "Texture did not grow.\n");
+    VERIFYF(!UnloadedEarly, "Unloaded early.\n");
+    VERIFYF(Unloaded.size() == 1 && Unloaded[0] == PreviousID, "Previous font texture was not unloaded.\n");
+    return !Previous->IsValid();
+})
+
+TEST_CASE(DynamicGlyphsUpdateUnsupported,
+{
+    const std::shared_ptr<OctaneGUI::Font> Font = OctaneGUI::Font::Create(Application.GetTheme()->GetFont()->Path(), 18.0f);
+    VERIFY(Font != nullptr);
+
+    // Without texture updates the glyph can't be uploaded, so no cell is taken for it.
+    const OctaneGUI::Vector2 Missing = Font->Measure((uint32_t)127);
+    Application.SetOnUpdateTexture(nullptr);
+    const OctaneGUI::Vector2 Alpha = Font->Measure((uint32_t)0x3B1);
+    Application.SetOnUpdateTexture([](uint32_t, const std::vector<uint8_t>&, uint32_t, uint32_t, uint32_t, uint32_t) -> void {});
+
+    VERIFY(Alpha == Missing);
+    return Font->DynamicGlyphCount() == 0;
+})
+
+TEST_CASE(GlyphBeforeUpload,
+{
+    OctaneGUI::Font Font;
+    VERIFY(Font.Bake(Application.GetTheme()->GetFont()->Path(), 18.0f, { OctaneGUI::Font::BasicLatin }));
+
+    // Glyphs looked up before the texture exists are not remembered as missing.
+    const OctaneGUI::Vector2 Missing = Font.Measure((uint32_t)127);
+    VERIFY(Font.Measure((uint32_t)0x3B1) == Missing);
+    VERIFY(Font.Upload());
+    return Font.Measure((uint32_t)0x3B1) != Missing;
+})
+
+TEST_CASE(FontCache,
+{
+    const std::filesystem::path Directory = std::filesystem::temp_directory_path() / "OctaneGUITests";
+    std::filesystem::remove_all(Directory);
+
+    const std::shared_ptr<OctaneGUI::Font> Default = Application.GetTheme()->GetFont();
+    OctaneGUI::Font::SetCacheDirectory(Directory.string().c_str());
+    const std::shared_ptr<OctaneGUI::Font> Baked = OctaneGUI::Font::Create(Default->Path(), 20.0f);
+    const bool Written = !std::filesystem::is_empty(Directory);
+    const std::shared_ptr<OctaneGUI::Font> Cached = OctaneGUI::Font::Create(Default->Path(), 20.0f);
+    OctaneGUI::Font::SetCacheDirectory("");
+    std::filesystem::remove_all(Directory);
+
+    VERIFY(Baked != nullptr && Cached != nullptr && Written);
+    VERIFY(Baked->GetTexture()->GetSize() == Cached->GetTexture()->GetSize());
+    VERIFY(Baked->Ascent() == Cached->Ascent() && Baked->Descent() == Cached->Descent());
+    VERIFY(Baked->Measure(U"Well Hello Friends! \u00e9\u00ff") == Cached->Measure(U"Well Hello Friends! \u00e9\u00ff"));
+    return Cached->Measure((uint32_t)0x3B1) == Baked->Measure((uint32_t)0x3B1);
+})
+
+TEST_CASE(FontCacheInvalidIndex,
+{
+    const std::filesystem::path Directory = std::filesystem::temp_directory_path() / "OctaneGUITests";
+    std::filesystem::remove_all(Directory);
+
+    const std::shared_ptr<OctaneGUI::Font> Default = Application.GetTheme()->GetFont();
+    OctaneGUI::Font::SetCacheDirectory(Directory.string().c_str());
+    const std::shared_ptr<OctaneGUI::Font> Baked = OctaneGUI::Font::Create(Default->Path(), 20.0f);
+
+    // Point the missing glyph past the cached glyphs. The offset matches the cache header in Font.cpp.
+    const std::filesystem::path Path = std::filesystem::directory_iterator(Directory)->path();
+    const uint32_t MissingGlyph = 0xFFFFFF;
+    {
+        std::fstream Stream(Path, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        Stream.seekp(44);
+        Stream.write(reinterpret_cast<const char*>(&MissingGlyph), sizeof(MissingGlyph));
+    }
+
+    const std::shared_ptr<OctaneGUI::Font> Cached = OctaneGUI::Font::Create(Default->Path(), 20.0f);
+    uint32_t Written = 0;
+    {
+        std::ifstream Stream(Path, std::ios_base::binary);
+        Stream.seekg(44);
+        Stream.read(reinterpret_cast<char*>(&Written), sizeof(Written));
+    }
+
+    OctaneGUI::Font::SetCacheDirectory("");
+    std::filesystem::remove_all(Directory);
+
+    // The invalid cache is baked again and replaced.
+    VERIFY(Baked != nullptr && Cached != nullptr && Written != MissingGlyph);
+    return Cached->Measure((uint32_t)0x4E2D) == Baked->Measure((uint32_t)0x4E2D);
+})
+
+TEST_CASE(DistanceField,
+{
+    const char* Path = Application.GetTheme()->GetFont()->Path();
+    const std::shared_ptr<OctaneGUI::Font> Source = OctaneGUI::Font::Create(Path, 32.0f, { OctaneGUI::Font::BasicLatin }, true);
+    VERIFY(Source != nullptr && Source->DistanceField());
+    VERIFY(OctaneGUI::Font::Create(Application.GetTheme()->GetFont(), 24.0f) == nullptr);
+
+    const std::shared_ptr<OctaneGUI::Font> Small = OctaneGUI::Font::Create(Source, 16.0f);
+    const std::shared_ptr<OctaneGUI::Font> Large = OctaneGUI::Font::Create(Source, 64.0f);
+    VERIFY(Small != nullptr && Large != nullptr && Small->DistanceField());
+    VERIFY(Small->GetTexture() == Source->GetTexture() && Large->GetTexture() == Source->GetTexture());
+    VERIFY(Small->Size() == 16.0f && Large->Ascent() == Source->Ascent() * 2.0f);
+
+    const float SmallWidth = Small->Measure(U"Well Hello Friends!").X;
+    const float LargeWidth = Large->Measure(U"Well Hello Friends!").X;
+    VERIFYF(std::abs(LargeWidth - SmallWidth * 4.0f) < 0.01f, "Expected scaled width of %.2f, got %.2f\n", SmallWidth * 4.0f, LargeWidth);
+
+    // Glyphs outside of the loaded range are rasterized into the shared atlas.
+    VERIFY(Large->Measure((uint32_t)0xE9).X == Small->Measure((uint32_t)0xE9).X * 4.0f);
+    VERIFY(Source->DynamicGlyphCount() == 1 && Small->DynamicGlyphCount() == 1);
+
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Application.GetTheme());
+    Brush.Text(Small, {}, U"Well", OctaneGUI::Color::White);
+    Brush.Text(Large, {}, U"Hello", OctaneGUI::Color::White);
+    Brush.Text(Application.GetTheme()->GetFont(), {}, U"Friends", OctaneGUI::Color::White);
+    VERIFYF(Buffer.Commands().size() == 2, "Expected 2 commands, got %zu\n", Buffer.Commands().size());
+    return Buffer.Commands()[0].DistanceField() && !Buffer.Commands()[1].DistanceField();
+})
+
+TEST_CASE(ThemeDistanceField,
+{
+    OctaneGUI::Theme Theme;
+    Theme.Load(OctaneGUI::Json::Parse(R"({
+        "FontPath": "Resources/Roboto-Regular.ttf",
+        "FontSize": 18,
+        "FontDistanceField": true,
+        "Fonts": [{"Size": 24}, {"Size": 12}]
+    })"));
+
+    const std::vector<std::shared_ptr<OctaneGUI::Font>>& Fonts = Theme.Fonts();
+    VERIFYF(Fonts.size() == 3, "Expected 3 fonts, got %zu\n", Fonts.size());
+    VERIFY(Theme.GetFont()->Size() == 18.0f && Theme.GetFont()->DistanceField());
+
+    const std::shared_ptr<OctaneGUI::Font> Added = Theme.GetOrAddFont(nullptr, 40.0f);
+    VERIFY(Added != nullptr && Added->DistanceField() && Theme.Fonts().size() == 4);
+    return Fonts[1]->GetTexture() == Theme.GetFont()->GetTexture() && Added->GetTexture() == Theme.GetFont()->GetTexture();
+})
+
+TEST_CASE(LineIndex,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "Text", "ID": "Text", "Text": "Well\nHello\n\nFriends"})", List);
+
+    const std::shared_ptr<OctaneGUI::Text> Text = List.To<OctaneGUI::Text>("Text");
+    VERIFYF(Text->LineCount() == 4, "Expected 4 lines, got %u\n", Text->LineCount());
+    VERIFY(Text->LineStart(1) == 5 && Text->LineEnd(1) == 10);
+    VERIFY(Text->LineStart(2) == 11 && Text->LineEnd(2) == 11);
+    VERIFY(Text->LineOf(4) == 0 && Text->LineOf(5) == 1 && Text->LineOf(11) == 2 && Text->LineOf(12) == 3);
+    VERIFY(Text->LineEnd(3) == Text->Length());
+
+    Text->Insert(7, U"\nA\nB");
+    VERIFY(Text->GetString() == U"Well\nHe\nA\nBllo\n\nFriends");
+    VERIFYF(Text->LineCount() == 6, "Expected 6 lines after insert, got %u\n", Text->LineCount());
+    VERIFY(Text->LineStart(2) == 8 && Text->LineStart(3) == 10 && Text->LineStart(5) == 16);
+
+    Text->Erase(3, 10);
+    VERIFY(Text->GetString() == U"Welo\n\nFriends");
+    VERIFYF(Text->LineCount() == 3, "Expected 3 lines after erase, got %u\n", Text->LineCount());
+    return Text->LineStart(1) == 5 && Text->LineStart(2) == 6 && Text->LineOf(Text->Length()) == 2;
+})
+
+TEST_CASE(LayoutWrap,
+{
+    const std::shared_ptr<OctaneGUI::Font> Font = Application.GetTheme()->GetFont();
+    const float Width = Font->Measure(U"Well Hello ").X + 1.0f;
+
+    OctaneGUI::TextLayout Layout;
+    VERIFY(Layout.Update(Font, U"Well Hello Friends\nAgain", 1, Width));
+    VERIFYF(Layout.LineCount() == 3, "Expected 3 lines, got %u\n", Layout.LineCount());
+    VERIFY(Layout.Lines()[1].Start == 11 && Layout.Lines()[2].Start == 19);
+
+    // Newlines are not drawn, so every other character has a glyph.
+    VERIFYF(Layout.Rects().size() == 23, "Expected 23 glyphs, got %zu\n", Layout.Rects().size());
+    VERIFY(Layout.Indices()[Layout.Lines()[2].Glyph] == 19);
+    VERIFY(Layout.Size().Y == Font->Size() * 3.0f && Layout.Size().X <= Width);
+
+    // A word wider than the wrap width stays on the line it starts.
+    VERIFY(Layout.Update(Font, U"Well", 2, 1.0f));
+    return Layout.LineCount() == 1 && Layout.Rects().size() == 4;
+})
+
+TEST_CASE(LayoutCached,
+{
+    const std::shared_ptr<OctaneGUI::Font> Font = Application.GetTheme()->GetFont();
+
+    OctaneGUI::TextLayout Layout;
+    VERIFY(Layout.Update(Font, U"Well Hello Friends", 1, 100.0f));
+    VERIFY(!Layout.Update(Font, U"Well Hello Friends", 1, 100.0f));
+    VERIFY(Layout.Update(Font, U"Well Hello Friends", 1, 200.0f));
+    VERIFY(Layout.Update(Font, U"Well Hello", 2, 200.0f));
+
+    Layout.Invalidate();
+    VERIFY(Layout.Update(Font, U"Well Hello", 2, 200.0f));
+
+    // Copying the layout into a buffer produces the same vertices as laying the text out while painting.
+    std::vector<OctaneGUI::TextSpan> Spans;
+    Spans.push_back({ 0, 4, OctaneGUI::Color::White });
+    Spans.push_back({ 5, 10, OctaneGUI::Color(255, 0, 0, 255) });
+    OctaneGUI::VertexBuffer Cached;
+    OctaneGUI::Paint CachedBrush(Cached, Application.GetTheme());
+    CachedBrush.Text(Layout, { 10.0f, 20.0f }, Spans);
+
+    OctaneGUI::VertexBuffer Wrapped;
+    OctaneGUI::Paint WrappedBrush(Wrapped, Application.GetTheme());
+    WrappedBrush.TextWrapped(Font, { 10.0f, 20.0f }, U"Well Hello", Spans, 200.0f);
+
+    VERIFYF(Cached.GetVertexCount() == 36, "Expected 36 vertices, got %u\n", Cached.GetVertexCount());
+    VERIFY(Cached.Commands().size() == 1);
+    VERIFY(Cached.GetVertexCount() == Wrapped.GetVertexCount());
+    for (uint32_t I = 0; I < Cached.GetVertexCount(); I++)
+    {
+        VERIFY(Cached.GetVertices()[I].Position == Wrapped.GetVertices()[I].Position);
+    }
+    return Cached.GetVertices()[16].Col == OctaneGUI::Color(255, 0, 0, 255);
+})
+
+TEST_CASE(WrappedText,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, "", R"({"Type": "Text", "ID": "Text", "Text": "Well Hello Friends", "Wrap": true})", List, 200, 200);
+
+    const std::shared_ptr<OctaneGUI::Text> Text = List.To<OctaneGUI::Text>("Text");
+    const float Height = Text->GetSize().Y;
+
+    Text->SetText("Well Hello Friends Well Hello Friends Well Hello Friends");
+    return Text->GetSize().Y > Height && Text->GetSize().X <= Text->GetParent()->GetSize().X;
+})
+
 )
 
 }
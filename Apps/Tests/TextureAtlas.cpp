@@ -0,0 +1,101 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+
+namespace Tests
+{
+
+TEST_SUITE(TextureAtlas,
+
+TEST_CASE(FontsSharePage,
+{
+    const char* Path = Application.GetTheme()->GetFont()->Path();
+    OctaneGUI::Texture::SetAtlasPageSize(2048);
+    const std::shared_ptr<OctaneGUI::Font> Small = OctaneGUI::Font::Create(Path, 12.0f);
+    const std::shared_ptr<OctaneGUI::Font> Large = OctaneGUI::Font::Create(Path, 20.0f);
+    const uint32_t PageCount = OctaneGUI::Texture::AtlasPageCount();
+    OctaneGUI::Texture::SetAtlasPageSize(0);
+
+    VERIFYF(PageCount == 1, "Expected 1 atlas page, got %u\n", PageCount);
+    VERIFY(Small->GetTexture()->IsShared() && Large->GetTexture()->IsShared());
+    VERIFY(Small->GetTexture()->GetID() == Large->GetTexture()->GetID());
+
+    // Text drawn with both fonts is submitted with a single command.
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Application.GetTheme());
+    Brush.Text(Small, { 0.0f, 0.0f }, U"Small", OctaneGUI::Color::White);
+    Brush.Text(Large, { 0.0f, 20.0f }, U"Large", OctaneGUI::Color::White);
+    VERIFYF(Buffer.Commands().size() == 1, "Expected 1 command, got %zu\n", Buffer.Commands().size());
+
+    // Glyph coordinates must stay within the font's region of the page.
+    const OctaneGUI::Rect Region = Large->GetTexture()->Normalize({ {}, Large->GetTexture()->GetSize() });
+    OctaneGUI::Vector2 Position;
+    OctaneGUI::Rect Vertices;
+    OctaneGUI::Rect TexCoords;
+    Large->Draw((uint32_t)'A', Position, Vertices, TexCoords);
+    return Region.Contains(TexCoords.Min) && Region.Contains(TexCoords.Max);
+})
+
+TEST_CASE(LargeImageFallback,
+{
+    OctaneGUI::Texture::SetAtlasPageSize(256);
+    const std::shared_ptr<OctaneGUI::Texture> Small = OctaneGUI::Texture::LoadShared(std::vector<uint8_t>(32 * 32 * 4, 255), 32, 32);
+    const std::shared_ptr<OctaneGUI::Texture> Large = OctaneGUI::Texture::LoadShared(std::vector<uint8_t>(200 * 200 * 4, 255), 200, 200);
+    const uint32_t PageCount = OctaneGUI::Texture::AtlasPageCount();
+    OctaneGUI::Texture::SetAtlasPageSize(0);
+
+    VERIFY(Small != nullptr);
+    VERIFY(Large != nullptr);
+    VERIFYF(PageCount == 1, "Expected 1 atlas page, got %u\n", PageCount);
+    VERIFY(Small->IsShared() && !Large->IsShared());
+    VERIFY(Large->Normalize({ {}, { 200.0f, 200.0f } }).Max == OctaneGUI::Vector2(1.0f, 1.0f));
+    return Small->Normalize({ {}, { 32.0f, 32.0f } }).Max.X <= 32.0f / 256.0f + 0.01f;
+})
+
+TEST_CASE(UpdateUnsupported,
+{
+    const std::vector<uint8_t> Data(32 * 32 * 4, 255);
+    OctaneGUI::Texture::SetAtlasPageSize(256);
+    Application.SetOnUpdateTexture(nullptr);
+    const std::shared_ptr<OctaneGUI::Texture> Unsupported = OctaneGUI::Texture::LoadShared(Data, 32, 32);
+    const uint32_t PageCount = OctaneGUI::Texture::AtlasPageCount();
+
+    // No space was packed for the image that could not be uploaded.
+    Application.SetOnUpdateTexture([](uint32_t, const std::vector<uint8_t>&, uint32_t, uint32_t, uint32_t, uint32_t) -> void {});
+    const std::shared_ptr<OctaneGUI::Texture> Supported = OctaneGUI::Texture::LoadShared(Data, 32, 32);
+    OctaneGUI::Texture::SetAtlasPageSize(0);
+
+    VERIFY(Unsupported != nullptr && !Unsupported->IsShared());
+    VERIFYF(PageCount == 0, "Expected 0 atlas pages, got %u\n", PageCount);
+    VERIFY(Supported != nullptr && Supported->IsShared());
+    return Supported->Normalize({ {}, { 32.0f, 32.0f } }).Min == OctaneGUI::Vector2();
+})
+
+)
+
+}
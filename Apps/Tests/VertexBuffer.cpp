@@ -0,0 +1,237 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+#include "Utility.h"
+
+namespace Tests
+{
+
+void AddQuad(OctaneGUI::VertexBuffer& Buffer, const OctaneGUI::Rect& Bounds, uint32_t TextureID)
+{
+    Buffer.PushCommand(6, TextureID, {});
+    Buffer.AddVertex(Bounds.Min, OctaneGUI::Color::White);
+    Buffer.AddVertex({ Bounds.Max.X, Bounds.Min.Y }, OctaneGUI::Color::White);
+    Buffer.AddVertex(Bounds.Max, OctaneGUI::Color::White);
+    Buffer.AddVertex({ Bounds.Min.X, Bounds.Max.Y }, OctaneGUI::Color::White);
+    Buffer.AddIndex(0);
+    Buffer.AddIndex(1);
+    Buffer.AddIndex(2);
+    Buffer.AddIndex(0);
+    Buffer.AddIndex(2);
+    Buffer.AddIndex(3);
+}
+
+TEST_SUITE(VertexBuffer,
+
+TEST_CASE(Reserve,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    Buffer.Reserve(8, 12, 2);
+
+    for (int I = 0; I < 8; I++)
+    {
+        Buffer.AddVertex({ (float)I, 0.0f }, OctaneGUI::Color::White);
+    }
+
+    VERIFYF(Buffer.AllocationCount() == 0, "Reserved buffer reallocated %d times.\n", Buffer.AllocationCount());
+
+    Buffer.AddVertex({ 8.0f, 0.0f }, OctaneGUI::Color::White);
+    return Buffer.AllocationCount() == 1;
+})
+
+TEST_CASE(ClearKeepsCapacity,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    for (int I = 0; I < 100; I++)
+    {
+        Buffer.AddVertex({ (float)I, 0.0f }, OctaneGUI::Color::White);
+        Buffer.AddIndex(I);
+    }
+
+    VERIFY(Buffer.AllocationCount() > 0);
+
+    Buffer.Clear();
+    VERIFY(Buffer.GetVertexCount() == 0);
+    VERIFY(Buffer.GetIndexCount() == 0);
+    VERIFY(Buffer.VertexHighWaterMark() == 100);
+
+    for (int I = 0; I < 100; I++)
+    {
+        Buffer.AddVertex({ (float)I, 0.0f }, OctaneGUI::Color::White);
+        Buffer.AddIndex(I);
+    }
+
+    return Buffer.AllocationCount() == 0;
+})
+
+TEST_CASE(WindowReusesBuffer,
+{
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"Type": "VerticalContainer", "Controls": [
+        {"Type": "TextButton", "Text": {"Text": "One"}},
+        {"Type": "TextButton", "Text": {"Text": "Two"}},
+        {"Type": "Text", "Text": "Some text to paint."}
+    ]})", List);
+
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    Application.Update();
+
+    const uint32_t VertexCount = Window->GetBuffer().GetVertexCount();
+    VERIFY(VertexCount > 0);
+
+    Window->GetRootContainer()->Invalidate(OctaneGUI::InvalidateType::Paint);
+    Application.Update();
+
+    const OctaneGUI::VertexBuffer& Buffer = Window->GetBuffer();
+    VERIFYF(Buffer.GetVertexCount() == VertexCount, "Vertex count changed between frames: %d != %d\n", Buffer.GetVertexCount(), VertexCount);
+    return Buffer.AllocationCount() == 0;
+})
+
+TEST_CASE(Coalesce,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Application.GetTheme());
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.Rectangle({ 20.0f, 0.0f, 30.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.Rectangle({ 40.0f, 0.0f, 50.0f, 10.0f }, OctaneGUI::Color::White);
+
+    VERIFYF(Buffer.Commands().size() == 1, "Expected 1 command but have %zu.\n", Buffer.Commands().size());
+    VERIFY(Buffer.Commands()[0].IndexCount() == 18);
+    VERIFY(Buffer.SubmittedCommands() == 3);
+    VERIFY(Buffer.BatchRatio() == 3.0f);
+
+    // Indices of the merged draws must point at their own vertices.
+    const OctaneGUI::DrawCommand& Command = Buffer.Commands()[0];
+    const OctaneGUI::Vertex& Vertex = Buffer.GetVertices()[Buffer.GetIndices()[12] + Command.VertexOffset()];
+    return Vertex.Position == OctaneGUI::Vector2(40.0f, 0.0f);
+})
+
+TEST_CASE(CoalesceClip,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    OctaneGUI::Paint Brush(Buffer, Application.GetTheme());
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.PushClip({ 0.0f, 0.0f, 20.0f, 20.0f });
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+    Brush.PopClip();
+    Brush.BreakBatch();
+    Brush.Rectangle({ 0.0f, 0.0f, 10.0f, 10.0f }, OctaneGUI::Color::White);
+
+    VERIFYF(Buffer.Commands().size() == 3, "Expected 3 commands but have %zu.\n", Buffer.Commands().size());
+    return Buffer.Commands()[1].IndexCount() == 12;
+})
+
+TEST_CASE(SortByTexture,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    AddQuad(Buffer, { 0.0f, 0.0f, 10.0f, 10.0f }, 0);
+    AddQuad(Buffer, { 20.0f, 0.0f, 30.0f, 10.0f }, 1);
+    AddQuad(Buffer, { 40.0f, 0.0f, 50.0f, 10.0f }, 0);
+    VERIFY(Buffer.Commands().size() == 3);
+
+    Buffer.SortByTexture();
+    VERIFYF(Buffer.Commands().size() == 2, "Expected 2 commands but have %zu.\n", Buffer.Commands().size());
+
+    const OctaneGUI::DrawCommand& Command = Buffer.Commands()[0];
+    VERIFY(Command.TextureID() == 0 && Command.IndexCount() == 12);
+
+    const OctaneGUI::Vertex& Vertex = Buffer.GetVertices()[Buffer.GetIndices()[Command.IndexOffset() + 6] + Command.VertexOffset()];
+    return Vertex.Position == OctaneGUI::Vector2(40.0f, 0.0f);
+})
+
+TEST_CASE(SortByTextureOverlap,
+{
+    OctaneGUI::VertexBuffer Buffer;
+    AddQuad(Buffer, { 0.0f, 0.0f, 10.0f, 10.0f }, 0);
+    AddQuad(Buffer, { 20.0f, 0.0f, 30.0f, 10.0f }, 1);
+    AddQuad(Buffer, { 25.0f, 0.0f, 35.0f, 10.0f }, 0);
+
+    Buffer.SortByTexture();
+    return Buffer.Commands().size() == 3;
+})
+
+TEST_CASE(AddQuads,
+{
+    std::vector<OctaneGUI::Rect> Rects;
+    std::vector<OctaneGUI::Rect> UVs;
+    std::vector<OctaneGUI::Color> Colors;
+    for (int I = 0; I < 5; I++)
+    {
+        Rects.push_back({ (float)I * 10.0f, 1.0f, (float)I * 10.0f + 8.0f, 9.0f });
+        UVs.push_back({ (float)I * 0.1f, 0.2f, (float)I * 0.1f + 0.05f, 0.3f });
+        Colors.push_back(OctaneGUI::Color(I * 50, 0, 0, 255));
+    }
+
+    // The reference is built one vertex and index at a time. The first quad is added before the
+    // others to check the indices are rebased when the commands merge.
+    OctaneGUI::VertexBuffer Expected;
+    for (size_t I = 0; I < Rects.size(); I++)
+    {
+        const OctaneGUI::Rect& Bounds = Rects[I];
+        const OctaneGUI::Rect& TexCoords = UVs[I];
+        Expected.PushCommand(6, 1, {});
+        Expected.AddVertex(Bounds.Min + OctaneGUI::Vector2(2.0f, 3.0f), TexCoords.Min, Colors[I]);
+        Expected.AddVertex(OctaneGUI::Vector2(Bounds.Max.X + 2.0f, Bounds.Min.Y + 3.0f), OctaneGUI::Vector2(TexCoords.Max.X, TexCoords.Min.Y), Colors[I]);
+        Expected.AddVertex(Bounds.Max + OctaneGUI::Vector2(2.0f, 3.0f), TexCoords.Max, Colors[I]);
+        Expected.AddVertex(OctaneGUI::Vector2(Bounds.Min.X + 2.0f, Bounds.Max.Y + 3.0f), OctaneGUI::Vector2(TexCoords.Min.X, TexCoords.Max.Y), Colors[I]);
+        Expected.AddIndex(0);
+        Expected.AddIndex(1);
+        Expected.AddIndex(2);
+        Expected.AddIndex(0);
+        Expected.AddIndex(2);
+        Expected.AddIndex(3);
+    }
+
+    const bool SIMD = OctaneGUI::VertexBuffer::SIMD();
+    for (int Pass = 0; Pass < 2; Pass++)
+    {
+        OctaneGUI::VertexBuffer::SetSIMD(Pass == 0);
+
+        OctaneGUI::VertexBuffer Buffer;
+        Buffer.PushCommand(6, 1, {});
+        Buffer.AddQuads(Rects.data(), UVs.data(), Colors.data(), 1, { 2.0f, 3.0f });
+        Buffer.PushCommand(24, 1, {});
+        Buffer.AddQuads(Rects.data() + 1, UVs.data() + 1, Colors.data() + 1, 4, { 2.0f, 3.0f });
+
+        VERIFY(Buffer.Commands().size() == 1 && Buffer.Commands()[0].IndexCount() == 30);
+        VERIFY(Buffer.GetVertexCount() == Expected.GetVertexCount() && Buffer.GetIndices() == Expected.GetIndices());
+        for (uint32_t I = 0; I < Buffer.GetVertexCount(); I++)
+        {
+            const OctaneGUI::Vertex& A = Buffer.GetVertices()[I];
+            const OctaneGUI::Vertex& B = Expected.GetVertices()[I];
+            VERIFYF(A.Position == B.Position && A.TexCoords == B.TexCoords && A.Col == B.Col, "Vertex %u differs with SIMD %s.\n", I, OctaneGUI::VertexBuffer::SIMD() ? "on" : "off");
+        }
+    }
+
+    OctaneGUI::VertexBuffer::SetSIMD(SIMD);
+    return true;
+})
+
+)
+
+}
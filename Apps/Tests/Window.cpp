@@ -0,0 +1,209 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+#include "OctaneGUI/OctaneGUI.h"
+#include "TestSuite.h"
+#include "Utility.h"
+
+#include <cmath>
+
+namespace Tests
+{
+
+TEST_SUITE(Window,
+
+TEST_CASE(PaintRegion,
+{
+    static bool Called = false;
+    static std::vector<OctaneGUI::Rect> Damage;
+    static uint32_t VertexCount = 0;
+
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"ID": "Container", "Type": "VerticalContainer", "Controls": [
+        {"ID": "Button1", "Type": "TextButton", "Text": {"Text": "Button 1"}},
+        {"ID": "Button2", "Type": "TextButton", "Text": {"Text": "Button 2"}},
+        {"Type": "Text", "Text": "Some text that is not damaged."}
+    ]})", List);
+
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    const std::shared_ptr<OctaneGUI::Button> Button1 = List.To<OctaneGUI::Button>("Container.Button1");
+
+    Called = false;
+    Application.SetOnPaintRegion([](OctaneGUI::Window*, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>& Regions) -> void
+        {
+            Called = true;
+            Damage = Regions;
+            VertexCount = Buffer.GetVertexCount();
+        });
+
+    // The first paint after a layout must always repaint the whole window.
+    Application.Update();
+    const bool CalledAfterLayout = Called;
+    const uint32_t FullVertexCount = Window->GetBuffer().GetVertexCount();
+
+    Utility::MouseMove(Application, Button1->GetAbsoluteBounds().GetCenter());
+    Application.Update();
+
+    Application.SetOnPaintRegion(nullptr);
+
+    VERIFYF(!CalledAfterLayout, "Partial paint was used after a layout.\n");
+    VERIFYF(Called, "Partial paint was not used when hovering a button.\n");
+    const OctaneGUI::Rect Bounds = Button1->GetAbsoluteBounds();
+    const OctaneGUI::Rect Expected(std::floor(Bounds.Min.X), std::floor(Bounds.Min.Y), std::ceil(Bounds.Max.X), std::ceil(Bounds.Max.Y));
+    VERIFYF(Damage.size() == 1 && Damage[0] == Expected, "Damaged regions do not match the hovered button.\n");
+    VERIFYF(VertexCount < FullVertexCount, "Partial paint did not reduce the vertex count: %d >= %d\n", VertexCount, FullVertexCount);
+    return true;
+})
+
+TEST_CASE(PaintRegionOverlap,
+{
+    static std::vector<OctaneGUI::Rect> Damage;
+
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"ID": "Container", "Type": "Container", "Expand": "Both", "Controls": [
+        {"ID": "Button1", "Type": "TextButton", "Text": {"Text": "Button 1"}},
+        {"ID": "Button2", "Type": "TextButton", "Text": {"Text": "Button 2"}}
+    ]})", List);
+
+    const std::shared_ptr<OctaneGUI::Button> Button1 = List.To<OctaneGUI::Button>("Container.Button1");
+    const std::shared_ptr<OctaneGUI::Button> Button2 = List.To<OctaneGUI::Button>("Container.Button2");
+
+    // Place the second button so that it partially overlaps the first one.
+    const OctaneGUI::Vector2 Size = Button1->GetSize();
+    Button1->SetPosition({ 10.0f, 10.0f });
+    Button2->SetPosition({ 10.0f + Size.X * 0.5f, 10.0f + Size.Y * 0.5f });
+
+    Damage.clear();
+    Application.SetOnPaintRegion([](OctaneGUI::Window*, const OctaneGUI::VertexBuffer&, const std::vector<OctaneGUI::Rect>& Regions) -> void
+        {
+            Damage = Regions;
+        });
+    Application.Update();
+
+    // Moving from one button to the other damages both of them in the same frame.
+    Utility::MouseMove(Application, Button1->GetAbsolutePosition() + OctaneGUI::Vector2(2.0f, 2.0f));
+    Application.Update();
+    Damage.clear();
+    Utility::MouseMove(Application, Button2->GetAbsoluteBounds().Max - OctaneGUI::Vector2(2.0f, 2.0f));
+    Application.Update();
+
+    Application.SetOnPaintRegion(nullptr);
+
+    VERIFYF(!Damage.empty(), "Partial paint was not used when hovering the buttons.\n");
+    for (size_t I = 0; I < Damage.size(); I++)
+    {
+        for (size_t J = I + 1; J < Damage.size(); J++)
+        {
+            VERIFYF(!Damage[I].Intersects(Damage[J]), "Damaged regions %zu and %zu overlap.\n", I, J);
+        }
+    }
+
+    bool Covered1 = false;
+    bool Covered2 = false;
+    for (const OctaneGUI::Rect& Region : Damage)
+    {
+        Covered1 = Covered1 || Region.Encompasses(Button1->GetAbsoluteBounds());
+        Covered2 = Covered2 || Region.Encompasses(Button2->GetAbsoluteBounds());
+    }
+
+    VERIFYF(Covered1 && Covered2, "Damaged regions do not cover both buttons.\n");
+    return true;
+})
+
+TEST_CASE(PaintRegionRounded,
+{
+    static std::vector<OctaneGUI::Rect> Damage;
+
+    OctaneGUI::ControlList List;
+    Utility::Load(Application, R"({"ID": "Container", "Type": "Container", "Expand": "Both", "Controls": [
+        {"ID": "Button", "Type": "TextButton", "Text": {"Text": "Button"}}
+    ]})", List);
+
+    // Place the button on fractional bounds so its edges only partially cover some pixels.
+    const std::shared_ptr<OctaneGUI::Button> Button = List.To<OctaneGUI::Button>("Container.Button");
+    Button->SetPosition({ 10.25f, 10.5f });
+    Button->SetSize(Button->GetSize() + OctaneGUI::Vector2(0.4f, 0.3f));
+
+    Damage.clear();
+    Application.SetOnPaintRegion([](OctaneGUI::Window*, const OctaneGUI::VertexBuffer&, const std::vector<OctaneGUI::Rect>& Regions) -> void
+        {
+            Damage = Regions;
+        });
+    Application.Update();
+
+    Utility::MouseMove(Application, Button->GetAbsoluteBounds().GetCenter());
+    Application.Update();
+
+    Application.SetOnPaintRegion(nullptr);
+
+    const OctaneGUI::Rect Bounds = Button->GetAbsoluteBounds();
+    VERIFYF(Damage.size() == 1, "Expected 1 damaged region but got %zu.\n", Damage.size());
+    VERIFYF(Damage[0].Encompasses(Bounds), "Damaged region does not cover the button.\n");
+    VERIFYF(Damage[0].Min == OctaneGUI::Vector2(std::floor(Bounds.Min.X), std::floor(Bounds.Min.Y)), "Damaged region minimum was not rounded down.\n");
+    VERIFYF(Damage[0].Max == OctaneGUI::Vector2(std::ceil(Bounds.Max.X), std::ceil(Bounds.Max.Y)), "Damaged region maximum was not rounded up.\n");
+    return true;
+})
+
+TEST_CASE(NextTimerTimeout,
+{
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    VERIFYF(Window->NextTimerTimeout() == -1, "A timeout was given with no running timers.\n");
+
+    const std::shared_ptr<OctaneGUI::Timer> Long = Window->CreateTimer(5000, false, []() -> void {});
+    const std::shared_ptr<OctaneGUI::Timer> Short = Window->CreateTimer(1000, false, []() -> void {});
+    Long->Start();
+    Short->Start();
+    const int Timeout = Window->NextTimerTimeout();
+
+    Short->Stop();
+    const int StoppedTimeout = Window->NextTimerTimeout();
+    Long->Stop();
+
+    VERIFYF(Timeout > 900 && Timeout <= 1000, "Timeout %d does not match the shortest timer.\n", Timeout);
+    VERIFYF(StoppedTimeout > 1000 && StoppedTimeout <= 5000, "Timeout %d does not match the remaining timer.\n", StoppedTimeout);
+    return Window->NextTimerTimeout() == -1;
+})
+
+TEST_CASE(HasPendingWork,
+{
+    OctaneGUI::ControlList List;
+    const std::shared_ptr<OctaneGUI::Window> Window = Application.GetMainWindow();
+    Window->Load(R"({"Body": {"Controls": [{"ID": "Button", "Type": "TextButton", "Text": {"Text": "Button"}}]}})", List);
+    VERIFYF(Window->HasPendingWork(), "Loading controls did not request a layout.\n");
+
+    Window->Update();
+    Window->DoPaint();
+    VERIFYF(!Window->HasPendingWork(), "Work is still pending after an update and paint.\n");
+
+    List.To<OctaneGUI::Control>("Button")->Invalidate();
+    const bool Pending = Window->HasPendingWork();
+    Window->Update();
+    Window->DoPaint();
+    return Pending && !Window->HasPendingWork();
+})
+
+)
+
+}
@@ -106,16 +106,38 @@ OctaneGUI::Event OnEvent(OctaneGUI::Window* Window)
     return Windowing::Event(Window);
 }
 
+void OnWaitEvent(int Timeout)
+{
+    Windowing::WaitEvent(Timeout);
+}
+
 void OnPaint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
 {
     Rendering::Paint(Window, Buffer);
 }
 
+#if defined(OPENGL) || defined(SOFTWARE)
+void OnPaintRegion(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>& Damage)
+{
+    Rendering::PaintRegion(Window, Buffer, Damage);
+}
+#endif
+
 uint32_t OnLoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
 {
     return Rendering::LoadTexture(Data, Width, Height);
 }
 
+void OnUpdateTexture(uint32_t ID, const std::vector<uint8_t>& Data, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
+{
+    Rendering::UpdateTexture(ID, Data, X, Y, Width, Height);
+}
+
+void OnUnloadTexture(uint32_t ID)
+{
+    Rendering::UnloadTexture(ID);
+}
+
 void OnExit()
 {
     Rendering::Exit();
@@ -162,8 +184,11 @@ void Initialize(OctaneGUI::Application& Application)
         .SetOnWindowAction(OnWindowAction)
         .SetOnNewFrame(OnNewFrame)
         .SetOnEvent(OnEvent)
+        .SetOnWaitEvent(OnWaitEvent)
         .SetOnPaint(OnPaint)
         .SetOnLoadTexture(OnLoadTexture)
+        .SetOnUpdateTexture(OnUpdateTexture)
+        .SetOnUnloadTexture(OnUnloadTexture)
         .SetOnExit(OnExit)
         .SetOnSetClipboardContents(OnSetClipboardContents)
         .SetOnGetClipboardContents(OnGetClipboardContents)
@@ -172,6 +197,11 @@ void Initialize(OctaneGUI::Application& Application)
 
     Application.FS()
         .SetOnFileDialog(OnFileDialog);
+
+#if defined(OPENGL) || defined(SOFTWARE)
+    // Only the OpenGL and software renderers are able to preserve the previous frame outside of the damaged regions.
+    Application.SetOnPaintRegion(OnPaintRegion);
+#endif
 }
 
 }
@@ -447,6 +447,34 @@ uint32_t LoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t
 	return g_Textures.back().ID;
 }
 
+void UpdateTexture(uint32_t ID, const std::vector<uint8_t>& Data, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
+{
+	id<MTLTexture> Texture = GetTexture(ID);
+	if (Texture == nil)
+	{
+		return;
+	}
+
+	[Texture replaceRegion:
+		MTLRegionMake2D((NSUInteger)X, (NSUInteger)Y, (NSUInteger)Width, (NSUInteger)Height)
+		mipmapLevel:0
+		withBytes:&Data[0]
+		bytesPerRow:(NSUInteger)Width * 4
+	];
+}
+
+void UnloadTexture(uint32_t ID)
+{
+	for (std::vector<TextureID>::iterator It = g_Textures.begin(); It != g_Textures.end(); ++It)
+	{
+		if (It->ID == ID)
+		{
+			g_Textures.erase(It);
+			break;
+		}
+	}
+}
+
 void Exit()
 {
 	g_Textures.clear();
@@ -43,6 +43,7 @@ SOFTWARE.
     #include "GL/glext.h"
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <unordered_map>
 #include <vector>
@@ -59,15 +60,36 @@ namespace Rendering
 
 std::vector<GLuint> g_Textures;
 GLuint g_Program = 0;
-GLuint g_VertexBuffer = 0;
-GLuint g_IndexBuffer = 0;
 GLuint g_DefaultTexture = 0;
 GLint g_UniformTexture;
 GLint g_UniformProjection;
+GLint g_UniformDistanceField;
 GLint g_AttribPosition;
 GLint g_AttribUV;
 GLint g_AttribColor;
 
+// GPU objects owned by a single window. These persist across frames so painting does not need to
+// recreate the vertex array or reallocate buffer storage.
+//
+// Each window is rendered into its own framebuffer which is then copied to the window. This
+// allows frames that only update a few damaged regions to keep the rest of the previous frame.
+struct RenderContext
+{
+public:
+    GLuint Framebuffer { 0 };
+    GLuint Texture { 0 };
+    int Width { 0 };
+    int Height { 0 };
+
+    GLuint VertexArray { 0 };
+    GLuint VertexBuffer { 0 };
+    GLuint IndexBuffer { 0 };
+    GLsizeiptr VertexCapacity { 0 };
+    GLsizeiptr IndexCapacity { 0 };
+};
+
+std::unordered_map<OctaneGUI::Window*, RenderContext> g_Contexts;
+
 PFNGLCREATESHADERPROC glCreateShader;
 PFNGLDELETESHADERPROC glDeleteShader;
 PFNGLSHADERSOURCEPROC glShaderSource;
@@ -88,6 +110,7 @@ PFNGLGENBUFFERSPROC glGenBuffers;
 PFNGLDELETEBUFFERSPROC glDeleteBuffers;
 PFNGLBINDBUFFERPROC glBindBuffer;
 PFNGLBUFFERDATAPROC glBufferData;
+PFNGLBUFFERSUBDATAPROC glBufferSubData;
 PFNGLBLENDFUNCSEPARATEPROC glBlendFuncSeparate;
 PFNGLUNIFORM1IPROC glUniform1i;
 PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv;
@@ -98,6 +121,12 @@ PFNGLBINDVERTEXARRAYPROC glBindVertexArray;
 PFNGLDELETEVERTEXARRAYSPROC glDeleteVertexArrays;
 PFNGLDRAWELEMENTSBASEVERTEXPROC glDrawElementsBaseVertex;
 PFNGLBLENDEQUATIONPROC glBlendEquation;
+PFNGLGENFRAMEBUFFERSPROC glGenFramebuffers;
+PFNGLDELETEFRAMEBUFFERSPROC glDeleteFramebuffers;
+PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer;
+PFNGLFRAMEBUFFERTEXTURE2DPROC glFramebufferTexture2D;
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glCheckFramebufferStatus;
+PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
 
 #if SDL2
     #define LOAD_PROC_ADDRESS(FnName) SDL_GL_GetProcAddress(#FnName)
@@ -175,14 +204,23 @@ void LoadShaders()
         "	gl_Position = Projection * vec4(Position.xy, 0, 1);\n"
         "}\n";
 
+    // Distance field textures store the distance to the glyph edge in alpha, with the edge at 0.5.
+    // The edge is smoothed over a single screen pixel so any scale stays sharp.
     const GLchar* FragmentShader =
         "uniform sampler2D Texture;\n"
+        "uniform int DistanceField;\n"
         "in vec2 Fragment_UV;\n"
         "in vec4 Fragment_Color;\n"
         "out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "	Out_Color = Fragment_Color * texture(Texture, Fragment_UV.st);\n"
+        "	vec4 Sample = texture(Texture, Fragment_UV.st);\n"
+        "	if (DistanceField != 0)\n"
+        "	{\n"
+        "		float Width = max(fwidth(Sample.a) * 0.5, 0.0001);\n"
+        "		Sample = vec4(Sample.rgb, smoothstep(0.5 - Width, 0.5 + Width, Sample.a));\n"
+        "	}\n"
+        "	Out_Color = Fragment_Color * Sample;\n"
         "}\n";
 
     const GLchar* VertexShaderInfo[2] = { Version, VertexShader };
@@ -210,22 +248,19 @@ void LoadShaders()
 
     g_UniformTexture = glGetUniformLocation(g_Program, "Texture");
     g_UniformProjection = glGetUniformLocation(g_Program, "Projection");
+    g_UniformDistanceField = glGetUniformLocation(g_Program, "DistanceField");
     g_AttribPosition = glGetAttribLocation(g_Program, "Position");
     g_AttribUV = glGetAttribLocation(g_Program, "UV");
     g_AttribColor = glGetAttribLocation(g_Program, "Color");
 
-    glGenBuffers(1, &g_VertexBuffer);
-    glGenBuffers(1, &g_IndexBuffer);
-
     assert(g_UniformTexture != -1);
     assert(g_UniformProjection != -1);
+    assert(g_UniformDistanceField != -1);
     assert(g_AttribPosition != -1);
     assert(g_AttribUV != -1);
     assert(g_AttribColor != -1);
 
     assert(g_Program != 0);
-    assert(g_VertexBuffer != 0);
-    assert(g_IndexBuffer != 0);
 }
 
 void LoadProcedures()
@@ -250,6 +285,7 @@ void LoadProcedures()
     LOAD_PROCEDURE(glDeleteBuffers, PFNGLDELETEBUFFERSPROC);
     LOAD_PROCEDURE(glBindBuffer, PFNGLBINDBUFFERPROC);
     LOAD_PROCEDURE(glBufferData, PFNGLBUFFERDATAPROC);
+    LOAD_PROCEDURE(glBufferSubData, PFNGLBUFFERSUBDATAPROC);
     LOAD_PROCEDURE(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC);
     LOAD_PROCEDURE(glUniform1i, PFNGLUNIFORM1IPROC);
     LOAD_PROCEDURE(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC);
@@ -260,6 +296,127 @@ void LoadProcedures()
     LOAD_PROCEDURE(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC);
     LOAD_PROCEDURE(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC);
     LOAD_PROCEDURE(glBlendEquation, PFNGLBLENDEQUATIONPROC);
+    LOAD_PROCEDURE(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC);
+    LOAD_PROCEDURE(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC);
+    LOAD_PROCEDURE(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC);
+    LOAD_PROCEDURE(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC);
+    LOAD_PROCEDURE(glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC);
+    LOAD_PROCEDURE(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC);
+}
+
+void DestroyTarget(RenderContext& Context)
+{
+    if (Context.Framebuffer != 0)
+    {
+        glDeleteFramebuffers(1, &Context.Framebuffer);
+        Context.Framebuffer = 0;
+    }
+
+    if (Context.Texture != 0)
+    {
+        glDeleteTextures(1, &Context.Texture);
+        Context.Texture = 0;
+    }
+
+    Context.Width = 0;
+    Context.Height = 0;
+}
+
+void DestroyContext(RenderContext& Context)
+{
+    DestroyTarget(Context);
+
+    if (Context.VertexArray != 0)
+    {
+        glDeleteVertexArrays(1, &Context.VertexArray);
+    }
+
+    if (Context.VertexBuffer != 0)
+    {
+        glDeleteBuffers(1, &Context.VertexBuffer);
+    }
+
+    if (Context.IndexBuffer != 0)
+    {
+        glDeleteBuffers(1, &Context.IndexBuffer);
+    }
+
+    Context = RenderContext();
+}
+
+void BindTarget(RenderContext& Context, int Width, int Height)
+{
+    if (Context.Framebuffer == 0 || Context.Width != Width || Context.Height != Height)
+    {
+        DestroyTarget(Context);
+
+        glGenTextures(1, &Context.Texture);
+        glBindTexture(GL_TEXTURE_2D, Context.Texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, Width, Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glGenFramebuffers(1, &Context.Framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, Context.Framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, Context.Texture, 0);
+        assert(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+
+        Context.Width = Width;
+        Context.Height = Height;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, Context.Framebuffer);
+}
+
+// The vertex layout never changes, so the attribute bindings are recorded into the vertex array once.
+void BindVertexArray(RenderContext& Context)
+{
+    if (Context.VertexArray != 0)
+    {
+        glBindVertexArray(Context.VertexArray);
+        return;
+    }
+
+    glGenVertexArrays(1, &Context.VertexArray);
+    glGenBuffers(1, &Context.VertexBuffer);
+    glGenBuffers(1, &Context.IndexBuffer);
+    assert(Context.VertexArray != 0);
+    assert(Context.VertexBuffer != 0);
+    assert(Context.IndexBuffer != 0);
+
+    glBindVertexArray(Context.VertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, Context.VertexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, Context.IndexBuffer);
+    glEnableVertexAttribArray(g_AttribPosition);
+    glEnableVertexAttribArray(g_AttribUV);
+    glEnableVertexAttribArray(g_AttribColor);
+    glVertexAttribPointer(g_AttribPosition, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, Position));
+    glVertexAttribPointer(g_AttribUV, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, TexCoords));
+    glVertexAttribPointer(g_AttribColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, Col));
+}
+
+// Storage grows geometrically and is orphaned before each upload so the driver can hand back fresh
+// memory instead of stalling on draws from the previous frame that may still be reading it.
+void Upload(GLenum Target, GLsizeiptr& Capacity, GLsizeiptr Size, const void* Data)
+{
+    if (Size == 0)
+    {
+        return;
+    }
+
+    if (Size > Capacity)
+    {
+        Capacity = std::max<GLsizeiptr>(Size, Capacity * 2);
+    }
+
+    glBufferData(Target, Capacity, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(Target, 0, Size, Data);
+}
+
+void SetScissor(const OctaneGUI::Rect& Scissor, const OctaneGUI::Vector2& Size)
+{
+    glScissor((GLint)Scissor.Min.X, (GLint)(Size.Y - Scissor.Max.Y), (GLsizei)Scissor.Width(), (GLsizei)Scissor.Height());
 }
 
 void Initialize()
@@ -313,9 +470,15 @@ void CreateRenderer(OctaneGUI::Window* Window)
 
 void DestroyRenderer(OctaneGUI::Window* Window)
 {
+    auto It = g_Contexts.find(Window);
+    if (It != g_Contexts.end())
+    {
+        DestroyContext(It->second);
+        g_Contexts.erase(It);
+    }
 }
 
-void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
+void Render(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>& Damage)
 {
 #if SDL2
     SDL_Window* Instance = Windowing::Get(Window);
@@ -323,13 +486,21 @@ void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
 #endif
 
     const OctaneGUI::Vector2 Size = Window->GetSize();
+    const OctaneGUI::Rect Bounds { OctaneGUI::Vector2::Zero, Size };
+    RenderContext& Context = g_Contexts[Window];
+    BindTarget(Context, (int)Size.X, (int)Size.Y);
     glViewport(0, 0, (int)Size.X, (int)Size.Y);
 
-    glClearColor(0, 0, 0, 255);
-    glClear(GL_COLOR_BUFFER_BIT);
+    // An empty damage list means the whole window is repainted.
+    const std::vector<OctaneGUI::Rect> Regions = Damage.empty() ? std::vector<OctaneGUI::Rect> { Bounds } : Damage;
 
-    GLuint VertexArrayObject = 0;
-    glGenVertexArrays(1, &VertexArrayObject);
+    glEnable(GL_SCISSOR_TEST);
+    glClearColor(0, 0, 0, 255);
+    for (const OctaneGUI::Rect& Region : Regions)
+    {
+        SetScissor(Region, Size);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
 
     glEnable(GL_BLEND);
     glBlendEquation(GL_FUNC_ADD);
@@ -337,7 +508,6 @@ void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
     glDisable(GL_CULL_FACE);
     glDisable(GL_DEPTH_TEST);
     glDisable(GL_STENCIL_TEST);
-    glEnable(GL_SCISSOR_TEST);
 
     float L = 0.0f;
     float R = Size.X;
@@ -352,57 +522,81 @@ void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
 
     glUseProgram(g_Program);
     glUniform1i(g_UniformTexture, 0);
+    glUniform1i(g_UniformDistanceField, 0);
     glUniformMatrix4fv(g_UniformProjection, 1, GL_FALSE, &Projection[0][0]);
 
-    glBindVertexArray(VertexArrayObject);
-
-    glBindBuffer(GL_ARRAY_BUFFER, g_VertexBuffer);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_IndexBuffer);
-    glEnableVertexAttribArray(g_AttribPosition);
-    glEnableVertexAttribArray(g_AttribUV);
-    glEnableVertexAttribArray(g_AttribColor);
-    glVertexAttribPointer(g_AttribPosition, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, Position));
-    glVertexAttribPointer(g_AttribUV, 2, GL_FLOAT, GL_FALSE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, TexCoords));
-    glVertexAttribPointer(g_AttribColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(OctaneGUI::Vertex), (GLvoid*)offsetof(OctaneGUI::Vertex, Col));
+    BindVertexArray(Context);
 
     const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
     const std::vector<uint32_t>& Indices = Buffer.GetIndices();
 
-    const GLsizeiptr VertexBufferSize = (GLsizeiptr)(Vertices.size() * sizeof(OctaneGUI::Vertex));
-    const GLsizeiptr IndexBufferSize = (GLsizeiptr)(Indices.size() * sizeof(uint32_t));
-
-    glBufferData(GL_ARRAY_BUFFER, VertexBufferSize, Vertices.data(), GL_STREAM_DRAW);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, IndexBufferSize, Indices.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, Context.VertexBuffer);
+    Upload(GL_ARRAY_BUFFER, Context.VertexCapacity, (GLsizeiptr)(Vertices.size() * sizeof(OctaneGUI::Vertex)), Vertices.data());
+    Upload(GL_ELEMENT_ARRAY_BUFFER, Context.IndexCapacity, (GLsizeiptr)(Indices.size() * sizeof(uint32_t)), Indices.data());
 
+    // Consecutive commands commonly share a texture or a clip, so only touch state that changes.
+    GLuint BoundTexture = 0;
+    bool BoundDistanceField = false;
+    OctaneGUI::Rect BoundScissor = Regions.back();
     for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
     {
-        OctaneGUI::Rect Scissor { OctaneGUI::Vector2::Zero, Size };
-        const OctaneGUI::Rect Clip = Command.Clip();
-        if (!Clip.IsZero())
+        const OctaneGUI::Rect Clip = Command.Clip().IsZero() ? Bounds : Command.Clip();
+
+        const GLuint Texture = Command.TextureID() == 0 ? g_DefaultTexture : (GLuint)Command.TextureID();
+        if (Texture != BoundTexture)
         {
-            Scissor = Clip;
+            glBindTexture(GL_TEXTURE_2D, Texture);
+            BoundTexture = Texture;
         }
-        glScissor((GLint)Scissor.Min.X, (GLint)(Size.Y - Scissor.Max.Y), (GLsizei)Scissor.Width(), (GLsizei)Scissor.Height());
 
-        if (Command.TextureID() == 0)
+        if (Command.DistanceField() != BoundDistanceField)
         {
-            glBindTexture(GL_TEXTURE_2D, g_DefaultTexture);
+            glUniform1i(g_UniformDistanceField, Command.DistanceField() ? 1 : 0);
+            BoundDistanceField = Command.DistanceField();
         }
-        else
+
+        for (const OctaneGUI::Rect& Region : Regions)
         {
-            glBindTexture(GL_TEXTURE_2D, Command.TextureID());
+            const OctaneGUI::Rect Scissor = Clip.Intersection(Region);
+            if (Scissor.Width() <= 0.0f || Scissor.Height() <= 0.0f)
+            {
+                continue;
+            }
+
+            if (!(Scissor == BoundScissor))
+            {
+                SetScissor(Scissor, Size);
+                BoundScissor = Scissor;
+            }
+
+            glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)Command.IndexCount(), GL_UNSIGNED_INT, (void*)(Command.IndexOffset() * sizeof(uint32_t)), (GLint)Command.VertexOffset());
         }
-
-        glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)Command.IndexCount(), GL_UNSIGNED_INT, (void*)(Command.IndexOffset() * sizeof(uint32_t)), (GLint)Command.VertexOffset());
     }
 
-    glDeleteVertexArrays(1, &VertexArrayObject);
+    glBindVertexArray(0);
+
+    // Present the whole framebuffer. Pixels outside of the damaged regions are kept from the previous frames.
+    glDisable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, Context.Framebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, Context.Width, Context.Height, 0, 0, Context.Width, Context.Height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
 #if SDL2
     SDL_GL_SwapWindow(Instance);
 #endif
 }
 
+void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
+{
+    Render(Window, Buffer, {});
+}
+
+void PaintRegion(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>& Damage)
+{
+    Render(Window, Buffer, Damage);
+}
+
 uint32_t LoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
 {
     GLuint Texture = 0;
@@ -421,19 +615,37 @@ uint32_t LoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t
     return Texture;
 }
 
-void Exit()
+void UpdateTexture(uint32_t ID, const std::vector<uint8_t>& Data, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
 {
-    if (g_VertexBuffer != 0)
+    GLint Current = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &Current);
+
+    glBindTexture(GL_TEXTURE_2D, ID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, X, Y, Width, Height, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<const void*>(Data.data()));
+
+    glBindTexture(GL_TEXTURE_2D, Current);
+}
+
+void UnloadTexture(uint32_t ID)
+{
+    const std::vector<GLuint>::iterator It = std::find(g_Textures.begin(), g_Textures.end(), (GLuint)ID);
+    if (It == g_Textures.end())
     {
-        glDeleteBuffers(1, &g_VertexBuffer);
-        g_VertexBuffer = 0;
+        return;
     }
 
-    if (g_IndexBuffer != 0)
+    glDeleteTextures(1, &*It);
+    g_Textures.erase(It);
+}
+
+void Exit()
+{
+    for (std::pair<OctaneGUI::Window* const, RenderContext>& Item : g_Contexts)
     {
-        glDeleteBuffers(1, &g_IndexBuffer);
-        g_IndexBuffer = 0;
+        DestroyContext(Item.second);
     }
+    g_Contexts.clear();
 
     if (g_Program != 0)
     {
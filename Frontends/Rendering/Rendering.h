@@ -32,6 +32,7 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+struct Rect;
 class Window;
 class VertexBuffer;
 
@@ -46,7 +47,10 @@ void Initialize();
 void CreateRenderer(OctaneGUI::Window* Window);
 void DestroyRenderer(OctaneGUI::Window* Window);
 void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer);
+void PaintRegion(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>& Damage);
 uint32_t LoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height);
+void UpdateTexture(uint32_t ID, const std::vector<uint8_t>& Data, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height);
+void UnloadTexture(uint32_t ID);
 void Exit();
 
 }
@@ -128,6 +128,30 @@ uint32_t LoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t
     return Result;
 }
 
+void UpdateTexture(uint32_t ID, const std::vector<uint8_t>& Data, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
+{
+    for (const std::unique_ptr<sf::Texture>& Texture : g_Textures)
+    {
+        if (Texture->getNativeHandle() == ID)
+        {
+            Texture->update(Data.data(), Width, Height, X, Y);
+            break;
+        }
+    }
+}
+
+void UnloadTexture(uint32_t ID)
+{
+    for (std::vector<std::unique_ptr<sf::Texture>>::iterator It = g_Textures.begin(); It != g_Textures.end(); ++It)
+    {
+        if ((*It)->getNativeHandle() == ID)
+        {
+            g_Textures.erase(It);
+            break;
+        }
+    }
+}
+
 void Exit()
 {
     g_Textures.clear();
@@ -0,0 +1,70 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OctaneGUI
+{
+
+class Window;
+
+}
+
+namespace Frontend
+{
+namespace Rendering
+{
+
+/// @brief Pixels painted by the software renderer for a window.
+///
+/// Each pixel is stored as 8-bit RGBA in memory order, row by row with no padding.
+struct Framebuffer
+{
+public:
+    uint32_t Width { 0 };
+    uint32_t Height { 0 };
+    const uint32_t* Pixels { nullptr };
+};
+
+/// @brief Retrieves the framebuffer of the last frame painted for the given window.
+///
+/// The pixels are valid until the window is painted again or destroyed. An empty framebuffer
+/// is returned if the window has not been painted.
+Framebuffer GetFramebuffer(OctaneGUI::Window* Window);
+
+/// @brief Sets the number of threads that rasterize the tiles of a frame.
+///
+/// The calling thread always takes part, so a count of 1 rasterizes without any workers.
+/// Zero, the default, uses the number of hardware threads.
+void SetThreadCount(uint32_t Count);
+
+/// @brief Number of threads that rasterize the tiles of a frame.
+uint32_t ThreadCount();
+
+}
+}
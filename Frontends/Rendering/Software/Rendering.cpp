@@ -0,0 +1,1118 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "../Rendering.h"
+#include "Interface.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// SSE2 is part of every x86-64 target and NEON of every AArch64 target, so no runtime detection
+// is needed. Define NO_SIMD to build only the scalar path.
+#if !defined(NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64))
+    #define SIMD_SSE
+    #include <emmintrin.h>
+#elif !defined(NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #define SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+#if SDL2
+    #include "../../Windowing/SDL2/Interface.h"
+    #include "SDL.h"
+#endif
+
+// Width and height in pixels of the tiles the framebuffer is divided into. Each triangle is binned
+// into every tile its bounds touch so a tile only visits the triangles that can cover it.
+#define TILE_SIZE 64
+
+// Opaque black, the same color the OpenGL renderer clears with.
+#define CLEAR_COLOR 0xFF000000
+
+// Frames with fewer triangles than this are rasterized on the calling thread, as waking the
+// workers would cost more than it saves.
+#define PARALLEL_MIN_TRIANGLES 256
+
+namespace Frontend
+{
+namespace Rendering
+{
+
+struct Texture
+{
+public:
+    uint32_t Width { 0 };
+    uint32_t Height { 0 };
+    std::vector<uint32_t> Pixels {};
+};
+
+// Pixel bounds where the maximum is exclusive.
+struct PixelRect
+{
+public:
+    int MinX { 0 };
+    int MinY { 0 };
+    int MaxX { 0 };
+    int MaxY { 0 };
+
+    bool IsEmpty() const
+    {
+        return MinX >= MaxX || MinY >= MaxY;
+    }
+};
+
+// A value that changes linearly across a triangle: Value = DX * X + DY * Y + C.
+struct Plane
+{
+public:
+    float DX { 0.0f };
+    float DY { 0.0f };
+    float C { 0.0f };
+
+    float At(float X, float Y) const
+    {
+        return DX * X + (DY * Y + C);
+    }
+};
+
+// A triangle that has been set up for rasterizing. The edge functions are positive inside of the
+// triangle. A pixel center that lies exactly on an edge is only covered by the triangle that owns
+// the edge so pixels along an edge shared by two triangles are not blended twice.
+//
+// The crossings give the pixel, as a function of Y, where each non-horizontal edge crosses a row.
+// A box is a pair of triangles that cover an axis aligned rectangle, which fills its bounds.
+struct Triangle
+{
+public:
+    Plane Edges[3] {};
+    Plane Crossings[3] {};
+    bool Owner[3] {};
+    Plane U {};
+    Plane V {};
+    Plane R {};
+    Plane G {};
+    Plane B {};
+    Plane A {};
+    PixelRect Bounds {};
+    const Texture* Source { nullptr };
+    uint32_t Color { 0 };
+    bool Flat { false };
+    bool DistanceField { false };
+    bool Box { false };
+};
+
+// Framebuffer and per-frame storage owned by a single window. The storage persists across
+// frames so painting does not need to reallocate it.
+struct RenderContext
+{
+public:
+    uint32_t Width { 0 };
+    uint32_t Height { 0 };
+    std::vector<uint32_t> Pixels {};
+
+    uint32_t TilesX { 0 };
+    uint32_t TilesY { 0 };
+    std::vector<PixelRect> Damage {};
+    std::vector<bool> Damaged {};
+    std::vector<std::vector<uint32_t>> Bins {};
+    std::vector<uint32_t> Tiles {};
+    std::vector<Triangle> Triangles {};
+};
+
+std::vector<Texture> g_Textures;
+std::unordered_map<OctaneGUI::Window*, RenderContext> g_Contexts;
+std::unique_ptr<OctaneGUI::TaskPool> g_Pool { nullptr };
+uint32_t g_ThreadCount { 0 };
+
+inline uint32_t Pack(uint32_t R, uint32_t G, uint32_t B, uint32_t A)
+{
+    return R | (G << 8) | (B << 16) | (A << 24);
+}
+
+inline uint32_t Channel(uint32_t Pixel, uint32_t Index)
+{
+    return (Pixel >> (Index * 8)) & 0xFF;
+}
+
+// Divides the product of two 8-bit values by 255 with rounding. Every path uses this so the
+// SIMD and scalar results are identical.
+inline uint32_t Div255(uint32_t Value)
+{
+    Value += 128;
+    return (Value + (Value >> 8)) >> 8;
+}
+
+inline int CeilToInt(float Value)
+{
+    const int Result = (int)Value;
+    return (float)Result < Value ? Result + 1 : Result;
+}
+
+inline uint32_t ToChannel(float Value)
+{
+    return (uint32_t)std::min(std::max(Value + 0.5f, 0.0f), 255.0f);
+}
+
+// Uses the same factors as the OpenGL renderer. The color channels are blended with SRC_ALPHA and
+// ONE_MINUS_SRC_ALPHA while the alpha channel is blended with ONE and ONE_MINUS_SRC_ALPHA.
+inline uint32_t Blend(uint32_t Src, uint32_t Dst)
+{
+    const uint32_t Alpha = Src >> 24;
+    if (Alpha == 255)
+    {
+        return Src;
+    }
+
+    if (Alpha == 0)
+    {
+        return Dst;
+    }
+
+    const uint32_t Inverse = 255 - Alpha;
+    return Pack(
+        Div255(Channel(Src, 0) * Alpha + Channel(Dst, 0) * Inverse),
+        Div255(Channel(Src, 1) * Alpha + Channel(Dst, 1) * Inverse),
+        Div255(Channel(Src, 2) * Alpha + Channel(Dst, 2) * Inverse),
+        Div255(Alpha * 255 + Channel(Dst, 3) * Inverse));
+}
+
+inline uint32_t Modulate(uint32_t Color, uint32_t Texel)
+{
+    return Pack(
+        Div255(Channel(Color, 0) * Channel(Texel, 0)),
+        Div255(Channel(Color, 1) * Channel(Texel, 1)),
+        Div255(Channel(Color, 2) * Channel(Texel, 2)),
+        Div255(Channel(Color, 3) * Channel(Texel, 3)));
+}
+
+#if defined(SIMD_SSE)
+inline __m128i Div255(__m128i Value)
+{
+    Value = _mm_add_epi16(Value, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(Value, _mm_srli_epi16(Value, 8)), 8);
+}
+
+// Blends two pixels that have been widened to 16-bit channels.
+inline __m128i Blend(__m128i Src, __m128i Dst)
+{
+    const __m128i Alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(Src, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128i ColorMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i AlphaOne = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i Factor = _mm_or_si128(_mm_and_si128(Alpha, ColorMask), AlphaOne);
+    const __m128i Inverse = _mm_sub_epi16(_mm_set1_epi16(255), Alpha);
+    return Div255(_mm_add_epi16(_mm_mullo_epi16(Src, Factor), _mm_mullo_epi16(Dst, Inverse)));
+}
+#elif defined(SIMD_NEON)
+inline uint8x8_t Div255(uint16x8_t Value)
+{
+    Value = vaddq_u16(Value, vdupq_n_u16(128));
+    return vshrn_n_u16(vaddq_u16(Value, vshrq_n_u16(Value, 8)), 8);
+}
+#endif
+
+// Blends a span of source pixels onto the destination.
+void BlendSpan(uint32_t* Dst, const uint32_t* Src, uint32_t Count)
+{
+    uint32_t I = 0;
+
+#if defined(SIMD_SSE)
+    const __m128i Zero = _mm_setzero_si128();
+    for (; I + 4 <= Count; I += 4)
+    {
+        const __m128i S = _mm_loadu_si128((const __m128i*)(Src + I));
+        const __m128i D = _mm_loadu_si128((const __m128i*)(Dst + I));
+        const __m128i Lo = Blend(_mm_unpacklo_epi8(S, Zero), _mm_unpacklo_epi8(D, Zero));
+        const __m128i Hi = Blend(_mm_unpackhi_epi8(S, Zero), _mm_unpackhi_epi8(D, Zero));
+        _mm_storeu_si128((__m128i*)(Dst + I), _mm_packus_epi16(Lo, Hi));
+    }
+#elif defined(SIMD_NEON)
+    const uint8x8_t Max = vdup_n_u8(255);
+    for (; I + 8 <= Count; I += 8)
+    {
+        const uint8x8x4_t S = vld4_u8((const uint8_t*)(Src + I));
+        const uint8x8x4_t D = vld4_u8((const uint8_t*)(Dst + I));
+        const uint8x8_t Inverse = vsub_u8(Max, S.val[3]);
+
+        uint8x8x4_t Result;
+        for (int C = 0; C < 3; C++)
+        {
+            Result.val[C] = Div255(vmlal_u8(vmull_u8(S.val[C], S.val[3]), D.val[C], Inverse));
+        }
+        Result.val[3] = Div255(vmlal_u8(vmull_u8(S.val[3], Max), D.val[3], Inverse));
+        vst4_u8((uint8_t*)(Dst + I), Result);
+    }
+#endif
+
+    for (; I < Count; I++)
+    {
+        Dst[I] = Blend(Src[I], Dst[I]);
+    }
+}
+
+// Blends a single color onto a span of pixels. Opaque colors are stored directly.
+void FillSpan(uint32_t* Dst, uint32_t Color, uint32_t Count)
+{
+    const uint32_t Alpha = Color >> 24;
+    if (Alpha == 0)
+    {
+        return;
+    }
+
+    uint32_t I = 0;
+    if (Alpha == 255)
+    {
+#if defined(SIMD_SSE)
+        const __m128i Value = _mm_set1_epi32((int)Color);
+        for (; I + 4 <= Count; I += 4)
+        {
+            _mm_storeu_si128((__m128i*)(Dst + I), Value);
+        }
+#elif defined(SIMD_NEON)
+        const uint32x4_t Value = vdupq_n_u32(Color);
+        for (; I + 4 <= Count; I += 4)
+        {
+            vst1q_u32(Dst + I, Value);
+        }
+#endif
+
+        for (; I < Count; I++)
+        {
+            Dst[I] = Color;
+        }
+        return;
+    }
+
+#if defined(SIMD_SSE)
+    // The source terms are the same for every pixel so they are only multiplied once.
+    const __m128i Zero = _mm_setzero_si128();
+    const __m128i Source = _mm_set_epi16(
+        (short)(Alpha * 255), (short)(Channel(Color, 2) * Alpha), (short)(Channel(Color, 1) * Alpha), (short)(Channel(Color, 0) * Alpha),
+        (short)(Alpha * 255), (short)(Channel(Color, 2) * Alpha), (short)(Channel(Color, 1) * Alpha), (short)(Channel(Color, 0) * Alpha));
+    const __m128i Factor = _mm_set1_epi16((short)(255 - Alpha));
+    for (; I + 4 <= Count; I += 4)
+    {
+        const __m128i D = _mm_loadu_si128((const __m128i*)(Dst + I));
+        const __m128i Lo = Div255(_mm_add_epi16(Source, _mm_mullo_epi16(_mm_unpacklo_epi8(D, Zero), Factor)));
+        const __m128i Hi = Div255(_mm_add_epi16(Source, _mm_mullo_epi16(_mm_unpackhi_epi8(D, Zero), Factor)));
+        _mm_storeu_si128((__m128i*)(Dst + I), _mm_packus_epi16(Lo, Hi));
+    }
+#elif defined(SIMD_NEON)
+    const uint16x8_t Source[4] = {
+        vdupq_n_u16((uint16_t)(Channel(Color, 0) * Alpha)),
+        vdupq_n_u16((uint16_t)(Channel(Color, 1) * Alpha)),
+        vdupq_n_u16((uint16_t)(Channel(Color, 2) * Alpha)),
+        vdupq_n_u16((uint16_t)(Alpha * 255)),
+    };
+    const uint8x8_t Factor = vdup_n_u8((uint8_t)(255 - Alpha));
+    for (; I + 8 <= Count; I += 8)
+    {
+        uint8x8x4_t D = vld4_u8((const uint8_t*)(Dst + I));
+        for (int C = 0; C < 4; C++)
+        {
+            D.val[C] = Div255(vmlal_u8(Source[C], D.val[C], Factor));
+        }
+        vst4_u8((uint8_t*)(Dst + I), D);
+    }
+#endif
+
+    for (; I < Count; I++)
+    {
+        Dst[I] = Blend(Color, Dst[I]);
+    }
+}
+
+inline uint32_t Texel(const Texture& Source, int X, int Y)
+{
+    X = std::min(std::max(X, 0), (int)Source.Width - 1);
+    Y = std::min(std::max(Y, 0), (int)Source.Height - 1);
+    return Source.Pixels[Y * Source.Width + X];
+}
+
+// Bilinear filtering like the OpenGL renderer's textures, with coordinates clamped to the edges.
+uint32_t Sample(const Texture& Source, float U, float V)
+{
+    const float X = U * (float)Source.Width - 0.5f;
+    const float Y = V * (float)Source.Height - 0.5f;
+    const float FloorX = std::floor(X);
+    const float FloorY = std::floor(Y);
+    const int X0 = (int)FloorX;
+    const int Y0 = (int)FloorY;
+    const uint32_t FX = (uint32_t)((X - FloorX) * 256.0f);
+    const uint32_t FY = (uint32_t)((Y - FloorY) * 256.0f);
+
+    const uint32_t T00 = Texel(Source, X0, Y0);
+    const uint32_t T10 = Texel(Source, X0 + 1, Y0);
+    const uint32_t T01 = Texel(Source, X0, Y0 + 1);
+    const uint32_t T11 = Texel(Source, X0 + 1, Y0 + 1);
+
+    uint32_t Result = 0;
+    for (uint32_t C = 0; C < 4; C++)
+    {
+        const uint32_t Top = Channel(T00, C) * (256 - FX) + Channel(T10, C) * FX;
+        const uint32_t Bottom = Channel(T01, C) * (256 - FX) + Channel(T11, C) * FX;
+        Result |= ((Top * (256 - FY) + Bottom * FY + 32768) >> 16) << (C * 8);
+    }
+
+    return Result;
+}
+
+// Matches the OpenGL shader. The edge is at 0.5 and smoothed over the change in distance between
+// neighboring pixels so any scale stays sharp.
+uint32_t Coverage(float Alpha, float AlphaX, float AlphaY)
+{
+    const float Width = std::max((std::abs(AlphaX - Alpha) + std::abs(AlphaY - Alpha)) * 0.5f, 0.0001f);
+    const float T = std::min(std::max((Alpha - (0.5f - Width)) / (2.0f * Width), 0.0f), 1.0f);
+    return ToChannel(T * T * (3.0f - 2.0f * T) * 255.0f);
+}
+
+inline float SampleAlpha(const Texture& Source, float U, float V)
+{
+    return (float)(Sample(Source, U, V) >> 24) / 255.0f;
+}
+
+PixelRect ToPixels(const OctaneGUI::Rect& Bounds, const RenderContext& Context)
+{
+    PixelRect Result;
+    Result.MinX = std::max((int)Bounds.Min.X, 0);
+    Result.MinY = std::max((int)Bounds.Min.Y, 0);
+    Result.MaxX = std::min((int)Bounds.Min.X + (int)Bounds.Width(), (int)Context.Width);
+    Result.MaxY = std::min((int)Bounds.Min.Y + (int)Bounds.Height(), (int)Context.Height);
+    return Result;
+}
+
+const Texture* GetTexture(uint32_t ID)
+{
+    if (ID == 0 || ID > g_Textures.size())
+    {
+        return nullptr;
+    }
+
+    return &g_Textures[ID - 1];
+}
+
+Plane AttributePlane(const OctaneGUI::Vector2* Points, float Value0, float Value1, float Value2, float Area)
+{
+    const OctaneGUI::Vector2 E1 = Points[1] - Points[0];
+    const OctaneGUI::Vector2 E2 = Points[2] - Points[0];
+    const float D1 = Value1 - Value0;
+    const float D2 = Value2 - Value0;
+
+    Plane Result;
+    Result.DX = (D1 * E2.Y - D2 * E1.Y) / Area;
+    Result.DY = (D2 * E1.X - D1 * E2.X) / Area;
+    Result.C = Value0 - Result.DX * Points[0].X - Result.DY * Points[0].Y;
+    return Result;
+}
+
+bool Setup(Triangle& Result, const OctaneGUI::Vertex* Vertices[3], const PixelRect& Scissor)
+{
+    OctaneGUI::Vector2 Points[3] { Vertices[0]->Position, Vertices[1]->Position, Vertices[2]->Position };
+    float Area = (Points[1].X - Points[0].X) * (Points[2].Y - Points[0].Y) - (Points[1].Y - Points[0].Y) * (Points[2].X - Points[0].X);
+    if (!(Area != 0.0f) || std::isnan(Area))
+    {
+        return false;
+    }
+
+    // Wind every triangle the same way so the inside of each edge is positive.
+    const OctaneGUI::Vertex* Ordered[3] { Vertices[0], Vertices[1], Vertices[2] };
+    if (Area < 0.0f)
+    {
+        std::swap(Points[1], Points[2]);
+        std::swap(Ordered[1], Ordered[2]);
+        Area = -Area;
+    }
+
+    Result.Bounds.MinX = std::max((int)std::floor(std::min({ Points[0].X, Points[1].X, Points[2].X })), Scissor.MinX);
+    Result.Bounds.MinY = std::max((int)std::floor(std::min({ Points[0].Y, Points[1].Y, Points[2].Y })), Scissor.MinY);
+    Result.Bounds.MaxX = std::min((int)std::ceil(std::max({ Points[0].X, Points[1].X, Points[2].X })), Scissor.MaxX);
+    Result.Bounds.MaxY = std::min((int)std::ceil(std::max({ Points[0].Y, Points[1].Y, Points[2].Y })), Scissor.MaxY);
+    if (Result.Bounds.IsEmpty())
+    {
+        return false;
+    }
+
+    for (int I = 0; I < 3; I++)
+    {
+        const OctaneGUI::Vector2& From = Points[I];
+        const OctaneGUI::Vector2& To = Points[(I + 1) % 3];
+        Plane& Edge = Result.Edges[I];
+        Edge.DX = From.Y - To.Y;
+        Edge.DY = To.X - From.X;
+        Edge.C = -(Edge.DX * From.X + Edge.DY * From.Y);
+        Result.Owner[I] = Edge.DX > 0.0f || (Edge.DX == 0.0f && Edge.DY > 0.0f);
+
+        if (Edge.DX != 0.0f)
+        {
+            Result.Crossings[I].DY = -Edge.DY / Edge.DX;
+            Result.Crossings[I].C = -Edge.C / Edge.DX - 0.5f;
+        }
+    }
+
+    Result.Box = false;
+
+    const OctaneGUI::Color& Col = Ordered[0]->Col;
+    Result.Flat = Col == Ordered[1]->Col && Col == Ordered[2]->Col;
+    Result.Color = Pack(Col.R, Col.G, Col.B, Col.A);
+
+    const OctaneGUI::Vertex& V0 = *Ordered[0];
+    const OctaneGUI::Vertex& V1 = *Ordered[1];
+    const OctaneGUI::Vertex& V2 = *Ordered[2];
+
+    if (Result.Source != nullptr)
+    {
+        Result.U = AttributePlane(Points, V0.TexCoords.X, V1.TexCoords.X, V2.TexCoords.X, Area);
+        Result.V = AttributePlane(Points, V0.TexCoords.Y, V1.TexCoords.Y, V2.TexCoords.Y, Area);
+    }
+
+    if (!Result.Flat)
+    {
+        Result.R = AttributePlane(Points, V0.Col.R, V1.Col.R, V2.Col.R, Area);
+        Result.G = AttributePlane(Points, V0.Col.G, V1.Col.G, V2.Col.G, Area);
+        Result.B = AttributePlane(Points, V0.Col.B, V1.Col.B, V2.Col.B, Area);
+        Result.A = AttributePlane(Points, V0.Col.A, V1.Col.A, V2.Col.A, Area);
+    }
+
+    return true;
+}
+
+// Whether two triangles split an axis aligned rectangle along one of its diagonals, as Paint emits
+// rectangles, images and glyphs. Each triangle must use three corners and leave out opposite ones.
+bool IsBox(const OctaneGUI::Vertex* Vertices[6])
+{
+    const OctaneGUI::Color& Col = Vertices[0]->Col;
+    OctaneGUI::Vector2 Min = Vertices[0]->Position;
+    OctaneGUI::Vector2 Max = Vertices[0]->Position;
+    for (int I = 1; I < 6; I++)
+    {
+        if (Vertices[I]->Col != Col)
+        {
+            return false;
+        }
+
+        Min = { std::min(Min.X, Vertices[I]->Position.X), std::min(Min.Y, Vertices[I]->Position.Y) };
+        Max = { std::max(Max.X, Vertices[I]->Position.X), std::max(Max.Y, Vertices[I]->Position.Y) };
+    }
+
+    if (!(Min.X < Max.X && Min.Y < Max.Y))
+    {
+        return false;
+    }
+
+    uint32_t Omitted[2] { 0, 0 };
+    for (int T = 0; T < 2; T++)
+    {
+        uint32_t Corners = 0;
+        for (int I = T * 3; I < T * 3 + 3; I++)
+        {
+            const OctaneGUI::Vector2& Position = Vertices[I]->Position;
+            if ((Position.X != Min.X && Position.X != Max.X) || (Position.Y != Min.Y && Position.Y != Max.Y))
+            {
+                return false;
+            }
+
+            Corners |= 1 << ((Position.X == Max.X ? 1 : 0) | (Position.Y == Max.Y ? 2 : 0));
+        }
+
+        switch (Corners)
+        {
+        case 0xE: Omitted[T] = 0; break;
+        case 0xD: Omitted[T] = 1; break;
+        case 0xB: Omitted[T] = 2; break;
+        case 0x7: Omitted[T] = 3; break;
+        default: return false;
+        }
+    }
+
+    return (Omitted[0] ^ Omitted[1]) == 3;
+}
+
+// Turns the first triangle of a box into the whole box. The texture coordinates of the second
+// triangle must lie on the same planes, which holds for any box that is not distorted.
+bool ToBox(Triangle& Result, const OctaneGUI::Vertex* Vertices[6])
+{
+    OctaneGUI::Vector2 Min = Vertices[0]->Position;
+    OctaneGUI::Vector2 Max = Vertices[0]->Position;
+    for (int I = 0; I < 6; I++)
+    {
+        const OctaneGUI::Vertex& Item = *Vertices[I];
+        Min = { std::min(Min.X, Item.Position.X), std::min(Min.Y, Item.Position.Y) };
+        Max = { std::max(Max.X, Item.Position.X), std::max(Max.Y, Item.Position.Y) };
+
+        if (Result.Source != nullptr
+            && (std::abs(Result.U.At(Item.Position.X, Item.Position.Y) - Item.TexCoords.X) > 1e-5f
+                || std::abs(Result.V.At(Item.Position.X, Item.Position.Y) - Item.TexCoords.Y) > 1e-5f))
+        {
+            return false;
+        }
+    }
+
+    // The pixels whose centers lie within the rectangle, with the left and top edges included
+    // like the edges the triangles own.
+    Result.Bounds.MinX = std::max(CeilToInt(Min.X - 0.5f), Result.Bounds.MinX);
+    Result.Bounds.MinY = std::max(CeilToInt(Min.Y - 0.5f), Result.Bounds.MinY);
+    Result.Bounds.MaxX = std::min(CeilToInt(Max.X - 0.5f), Result.Bounds.MaxX);
+    Result.Bounds.MaxY = std::min(CeilToInt(Max.Y - 0.5f), Result.Bounds.MaxY);
+    Result.Box = true;
+    return true;
+}
+
+inline bool Covered(const Triangle& Item, float X, float Y)
+{
+    for (int I = 0; I < 3; I++)
+    {
+        const float Value = Item.Edges[I].At(X, Y);
+        if (Value < 0.0f || (Value == 0.0f && !Item.Owner[I]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Shade(const Triangle& Item, uint32_t* Dst, int X, uint32_t Count, float Y)
+{
+    if (Item.Flat && Item.Source == nullptr)
+    {
+        FillSpan(Dst, Item.Color, Count);
+        return;
+    }
+
+    const float CX = (float)X + 0.5f;
+    float U = Item.U.At(CX, Y);
+    float V = Item.V.At(CX, Y);
+    float R = Item.R.At(CX, Y);
+    float G = Item.G.At(CX, Y);
+    float B = Item.B.At(CX, Y);
+    float A = Item.A.At(CX, Y);
+
+    // Each thread rasterizing tiles shades into its own row.
+    thread_local std::vector<uint32_t> Row;
+    if (Row.size() < Count)
+    {
+        Row.resize(Count);
+    }
+
+    uint32_t* Span = Row.data();
+    for (uint32_t I = 0; I < Count; I++)
+    {
+        const uint32_t Color = Item.Flat ? Item.Color : Pack(ToChannel(R), ToChannel(G), ToChannel(B), ToChannel(A));
+
+        if (Item.Source != nullptr)
+        {
+            uint32_t Texel = Sample(*Item.Source, U, V);
+            if (Item.DistanceField)
+            {
+                const float Alpha = (float)(Texel >> 24) / 255.0f;
+                const float AlphaX = SampleAlpha(*Item.Source, U + Item.U.DX, V + Item.V.DX);
+                const float AlphaY = SampleAlpha(*Item.Source, U + Item.U.DY, V + Item.V.DY);
+                Texel = (Texel & 0x00FFFFFF) | (Coverage(Alpha, AlphaX, AlphaY) << 24);
+            }
+
+            Span[I] = Modulate(Color, Texel);
+        }
+        else
+        {
+            Span[I] = Color;
+        }
+
+        U += Item.U.DX;
+        V += Item.V.DX;
+        R += Item.R.DX;
+        G += Item.G.DX;
+        B += Item.B.DX;
+        A += Item.A.DX;
+    }
+
+    BlendSpan(Dst, Span, Count);
+}
+
+// Walks the rows of the triangle within the tile. The covered span of each row is found from where
+// the row crosses each edge and then corrected with exact edge tests at both ends.
+void Rasterize(RenderContext& Context, const Triangle& Item, const PixelRect& Tile)
+{
+    const int MinX = std::max(Item.Bounds.MinX, Tile.MinX);
+    const int MaxX = std::min(Item.Bounds.MaxX, Tile.MaxX);
+    const int MinY = std::max(Item.Bounds.MinY, Tile.MinY);
+    const int MaxY = std::min(Item.Bounds.MaxY, Tile.MaxY);
+    if (MinX >= MaxX || MinY >= MaxY)
+    {
+        return;
+    }
+
+    if (Item.Box)
+    {
+        for (int Y = MinY; Y < MaxY; Y++)
+        {
+            uint32_t* Row = Context.Pixels.data() + (size_t)Y * Context.Width;
+            Shade(Item, Row + MinX, MinX, (uint32_t)(MaxX - MinX), (float)Y + 0.5f);
+        }
+        return;
+    }
+
+    for (int Y = MinY; Y < MaxY; Y++)
+    {
+        const float CY = (float)Y + 0.5f;
+        float Left = (float)MinX;
+        float Right = (float)(MaxX - 1);
+
+        bool Empty = false;
+        for (int I = 0; I < 3 && !Empty; I++)
+        {
+            const Plane& Edge = Item.Edges[I];
+            if (Edge.DX == 0.0f)
+            {
+                const float Row = Edge.DY * CY + Edge.C;
+                Empty = Row < 0.0f || (Row == 0.0f && !Item.Owner[I]);
+            }
+            else if (Edge.DX > 0.0f)
+            {
+                Left = std::max(Left, Item.Crossings[I].DY * CY + Item.Crossings[I].C);
+            }
+            else
+            {
+                Right = std::min(Right, Item.Crossings[I].DY * CY + Item.Crossings[I].C);
+            }
+        }
+
+        if (Empty || Left > Right + 1.0f)
+        {
+            continue;
+        }
+
+        // Both are within the tile here, so truncating floors the left side.
+        int First = (int)Left;
+        int Last = CeilToInt(Right);
+        while (First <= Last && !Covered(Item, (float)First + 0.5f, CY))
+        {
+            First++;
+        }
+
+        while (Last >= First && !Covered(Item, (float)Last + 0.5f, CY))
+        {
+            Last--;
+        }
+
+        if (First > Last)
+        {
+            continue;
+        }
+
+        uint32_t* Row = Context.Pixels.data() + (size_t)Y * Context.Width;
+        Shade(Item, Row + First, First, (uint32_t)(Last - First + 1), CY);
+    }
+}
+
+void Resize(RenderContext& Context, uint32_t Width, uint32_t Height)
+{
+    if (Context.Width == Width && Context.Height == Height)
+    {
+        return;
+    }
+
+    Context.Width = Width;
+    Context.Height = Height;
+    Context.Pixels.assign((size_t)Width * Height, CLEAR_COLOR);
+    Context.TilesX = (Width + TILE_SIZE - 1) / TILE_SIZE;
+    Context.TilesY = (Height + TILE_SIZE - 1) / TILE_SIZE;
+    Context.Bins.resize(Context.TilesX * Context.TilesY);
+    Context.Damaged.resize(Context.TilesX * Context.TilesY);
+}
+
+// Sets up every triangle that is visible within the region and records it in each damaged tile it
+// touches. Triangles are added in submission order so each tile is painted in the same order as the buffer.
+void Bin(RenderContext& Context, const OctaneGUI::VertexBuffer& Buffer, const OctaneGUI::Rect& Region)
+{
+    Context.Triangles.clear();
+    for (std::vector<uint32_t>& Item : Context.Bins)
+    {
+        Item.clear();
+    }
+
+    const OctaneGUI::Rect Bounds { 0.0f, 0.0f, (float)Context.Width, (float)Context.Height };
+    const std::vector<OctaneGUI::Vertex>& Vertices = Buffer.GetVertices();
+    const std::vector<uint32_t>& Indices = Buffer.GetIndices();
+
+    for (const OctaneGUI::DrawCommand& Command : Buffer.Commands())
+    {
+        const OctaneGUI::Rect Clip = Command.Clip().IsZero() ? Bounds : Command.Clip();
+        const PixelRect Scissor = ToPixels(Clip.Intersection(Region), Context);
+        if (Scissor.IsEmpty())
+        {
+            continue;
+        }
+
+        Triangle Item;
+        Item.Source = GetTexture(Command.TextureID());
+        Item.DistanceField = Command.DistanceField();
+
+        const uint32_t* CommandIndices = Indices.data() + Command.IndexOffset();
+        for (uint32_t I = 0; I + 2 < Command.IndexCount(); I += 3)
+        {
+            const OctaneGUI::Vertex* Points[6] {};
+            const uint32_t PointCount = I + 5 < Command.IndexCount() ? 6 : 3;
+            for (uint32_t J = 0; J < PointCount; J++)
+            {
+                Points[J] = &Vertices[CommandIndices[I + J] + Command.VertexOffset()];
+            }
+
+            const bool Box = PointCount == 6 && IsBox(Points);
+            if (!Setup(Item, Points, Scissor))
+            {
+                // Both triangles of a box have the same bounds, so neither is visible.
+                I += Box ? 3 : 0;
+                continue;
+            }
+
+            if (Box && ToBox(Item, Points))
+            {
+                I += 3;
+                if (Item.Bounds.IsEmpty())
+                {
+                    continue;
+                }
+            }
+
+            const uint32_t Index = (uint32_t)Context.Triangles.size();
+            Context.Triangles.push_back(Item);
+
+            const uint32_t TileMaxX = (uint32_t)(Item.Bounds.MaxX - 1) / TILE_SIZE;
+            const uint32_t TileMaxY = (uint32_t)(Item.Bounds.MaxY - 1) / TILE_SIZE;
+            for (uint32_t TileY = (uint32_t)Item.Bounds.MinY / TILE_SIZE; TileY <= TileMaxY; TileY++)
+            {
+                for (uint32_t TileX = (uint32_t)Item.Bounds.MinX / TILE_SIZE; TileX <= TileMaxX; TileX++)
+                {
+                    const uint32_t Tile = TileY * Context.TilesX + TileX;
+                    if (Context.Damaged[Tile])
+                    {
+                        Context.Bins[Tile].push_back(Index);
+                    }
+                }
+            }
+        }
+    }
+}
+
+uint32_t ResolveThreadCount()
+{
+    return g_ThreadCount == 0 ? std::max<uint32_t>(std::thread::hardware_concurrency(), 1) : g_ThreadCount;
+}
+
+PixelRect TileBounds(const RenderContext& Context, uint32_t Index)
+{
+    PixelRect Result;
+    Result.MinX = (int)((Index % Context.TilesX) * TILE_SIZE);
+    Result.MinY = (int)((Index / Context.TilesX) * TILE_SIZE);
+    Result.MaxX = std::min(Result.MinX + TILE_SIZE, (int)Context.Width);
+    Result.MaxY = std::min(Result.MinY + TILE_SIZE, (int)Context.Height);
+    return Result;
+}
+
+PixelRect Intersection(const PixelRect& A, const PixelRect& B)
+{
+    PixelRect Result;
+    Result.MinX = std::max(A.MinX, B.MinX);
+    Result.MinY = std::max(A.MinY, B.MinY);
+    Result.MaxX = std::min(A.MaxX, B.MaxX);
+    Result.MaxY = std::min(A.MaxY, B.MaxY);
+    return Result;
+}
+
+// Paints the triangles binned into a single tile in the order they were binned. The tile is clipped
+// to each damaged region it overlaps. The regions are disjoint so no pixel is painted twice.
+void RasterizeTile(RenderContext& Context, uint32_t Index)
+{
+    const PixelRect Tile = TileBounds(Context, Index);
+    for (const PixelRect& Region : Context.Damage)
+    {
+        const PixelRect Clip = Intersection(Tile, Region);
+        if (Clip.IsEmpty())
+        {
+            continue;
+        }
+
+        for (uint32_t Item : Context.Bins[Index])
+        {
+            Rasterize(Context, Context.Triangles[Item], Clip);
+        }
+    }
+}
+
+// Tiles cover separate pixels, so they can be painted on any thread in any order while each tile
+// keeps the painter's order of its own triangles. The calling thread and the workers claim tiles
+// from a shared counter until none are left, so a thread that finishes early keeps taking work
+// from the ones still busy with expensive tiles.
+void RasterizeTiles(RenderContext& Context)
+{
+    Context.Tiles.clear();
+    for (uint32_t I = 0; I < (uint32_t)Context.Bins.size(); I++)
+    {
+        if (!Context.Bins[I].empty())
+        {
+            Context.Tiles.push_back(I);
+        }
+    }
+
+    // Hand out the busiest tiles first so the last tiles claimed are cheap ones.
+    std::stable_sort(Context.Tiles.begin(), Context.Tiles.end(), [&Context](uint32_t A, uint32_t B) -> bool
+        {
+            return Context.Bins[A].size() > Context.Bins[B].size();
+        });
+
+    std::atomic<uint32_t> Next { 0 };
+    const OctaneGUI::TaskPool::Task Work = [&Context, &Next]() -> void
+    {
+        for (uint32_t I = Next++; I < (uint32_t)Context.Tiles.size(); I = Next++)
+        {
+            RasterizeTile(Context, Context.Tiles[I]);
+        }
+    };
+
+    const uint32_t ThreadCount = std::min(ResolveThreadCount(), (uint32_t)Context.Tiles.size());
+    if (ThreadCount <= 1 || Context.Triangles.size() < PARALLEL_MIN_TRIANGLES)
+    {
+        Work();
+        return;
+    }
+
+    if (!g_Pool || g_Pool->MaxThreads() + 1 < ThreadCount)
+    {
+        g_Pool = std::make_unique<OctaneGUI::TaskPool>(ResolveThreadCount() - 1);
+    }
+
+    for (uint32_t I = 1; I < ThreadCount; I++)
+    {
+        g_Pool->Add(OctaneGUI::TaskPool::Task(Work));
+    }
+
+    Work();
+    g_Pool->Wait();
+}
+
+#if SDL2
+void Present(OctaneGUI::Window* Window, const RenderContext& Context)
+{
+    SDL_Window* Instance = Windowing::Get(Window);
+    SDL_Surface* Surface = SDL_GetWindowSurface(Instance);
+    if (Surface == nullptr)
+    {
+        return;
+    }
+
+    if (SDL_MUSTLOCK(Surface))
+    {
+        SDL_LockSurface(Surface);
+    }
+
+    SDL_ConvertPixels(
+        std::min((int)Context.Width, Surface->w),
+        std::min((int)Context.Height, Surface->h),
+        SDL_PIXELFORMAT_RGBA32,
+        Context.Pixels.data(),
+        (int)(Context.Width * sizeof(uint32_t)),
+        Surface->format->format,
+        Surface->pixels,
+        Surface->pitch);
+
+    if (SDL_MUSTLOCK(Surface))
+    {
+        SDL_UnlockSurface(Surface);
+    }
+
+    SDL_UpdateWindowSurface(Instance);
+}
+#else
+// Without a windowing library the frame is only read back through GetFramebuffer.
+void Present(OctaneGUI::Window*, const RenderContext&)
+{
+}
+#endif
+
+void Render(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>& Damage)
+{
+    const OctaneGUI::Vector2 Size = Window->GetSize();
+    RenderContext& Context = g_Contexts[Window];
+    Resize(Context, (uint32_t)std::max(Size.X, 0.0f), (uint32_t)std::max(Size.Y, 0.0f));
+    if (Context.Pixels.empty())
+    {
+        return;
+    }
+
+    // An empty damage list means the whole window is repainted. Pixels outside of the damaged
+    // regions are kept from the previous frames.
+    const OctaneGUI::Rect Bounds { 0.0f, 0.0f, (float)Context.Width, (float)Context.Height };
+    const std::vector<OctaneGUI::Rect> Regions = Damage.empty() ? std::vector<OctaneGUI::Rect> { Bounds } : Damage;
+
+    // The buffer is binned once against the bounds of all regions. Only tiles that overlap a
+    // region are binned, and each of those is clipped to the regions when rasterized.
+    OctaneGUI::Rect Union = Regions.front();
+    Context.Damage.clear();
+    std::fill(Context.Damaged.begin(), Context.Damaged.end(), false);
+    for (const OctaneGUI::Rect& Region : Regions)
+    {
+        const PixelRect Clear = ToPixels(Region, Context);
+        if (Clear.IsEmpty())
+        {
+            continue;
+        }
+
+        for (int Y = Clear.MinY; Y < Clear.MaxY; Y++)
+        {
+            std::fill_n(Context.Pixels.data() + (size_t)Y * Context.Width + Clear.MinX, Clear.MaxX - Clear.MinX, CLEAR_COLOR);
+        }
+
+        for (uint32_t TileY = (uint32_t)Clear.MinY / TILE_SIZE; TileY <= (uint32_t)(Clear.MaxY - 1) / TILE_SIZE; TileY++)
+        {
+            for (uint32_t TileX = (uint32_t)Clear.MinX / TILE_SIZE; TileX <= (uint32_t)(Clear.MaxX - 1) / TILE_SIZE; TileX++)
+            {
+                Context.Damaged[TileY * Context.TilesX + TileX] = true;
+            }
+        }
+
+        Context.Damage.push_back(Clear);
+        Union.Min = { std::min(Union.Min.X, Region.Min.X), std::min(Union.Min.Y, Region.Min.Y) };
+        Union.Max = { std::max(Union.Max.X, Region.Max.X), std::max(Union.Max.Y, Region.Max.Y) };
+    }
+
+    Bin(Context, Buffer, Union);
+    RasterizeTiles(Context);
+
+    Present(Window, Context);
+}
+
+void Initialize()
+{
+}
+
+void CreateRenderer(OctaneGUI::Window*)
+{
+}
+
+void DestroyRenderer(OctaneGUI::Window* Window)
+{
+    g_Contexts.erase(Window);
+}
+
+void Paint(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer)
+{
+    Render(Window, Buffer, {});
+}
+
+void PaintRegion(OctaneGUI::Window* Window, const OctaneGUI::VertexBuffer& Buffer, const std::vector<OctaneGUI::Rect>& Damage)
+{
+    Render(Window, Buffer, Damage);
+}
+
+uint32_t LoadTexture(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
+{
+    Texture Result;
+    Result.Width = Width;
+    Result.Height = Height;
+    Result.Pixels.resize((size_t)Width * Height, 0);
+    std::memcpy(Result.Pixels.data(), Data.data(), std::min(Data.size(), Result.Pixels.size() * sizeof(uint32_t)));
+
+    g_Textures.push_back(std::move(Result));
+    return (uint32_t)g_Textures.size();
+}
+
+void UpdateTexture(uint32_t ID, const std::vector<uint8_t>& Data, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
+{
+    if (ID == 0 || ID > g_Textures.size())
+    {
+        return;
+    }
+
+    Texture& Target = g_Textures[ID - 1];
+    if (X + Width > Target.Width || Y + Height > Target.Height || Data.size() < (size_t)Width * Height * sizeof(uint32_t))
+    {
+        return;
+    }
+
+    for (uint32_t Row = 0; Row < Height; Row++)
+    {
+        std::memcpy(&Target.Pixels[(size_t)(Y + Row) * Target.Width + X], &Data[(size_t)Row * Width * sizeof(uint32_t)], Width * sizeof(uint32_t));
+    }
+}
+
+void UnloadTexture(uint32_t ID)
+{
+    if (ID == 0 || ID > g_Textures.size())
+    {
+        return;
+    }
+
+    // IDs are indices into the list, so the slot is kept and only the pixels are released.
+    Texture& Target = g_Textures[ID - 1];
+    Target.Width = 0;
+    Target.Height = 0;
+    Target.Pixels = std::vector<uint32_t>();
+}
+
+void Exit()
+{
+    g_Pool.reset();
+    g_Contexts.clear();
+    g_Textures.clear();
+}
+
+Framebuffer GetFramebuffer(OctaneGUI::Window* Window)
+{
+    Framebuffer Result;
+
+    const std::unordered_map<OctaneGUI::Window*, RenderContext>::const_iterator It = g_Contexts.find(Window);
+    if (It != g_Contexts.end())
+    {
+        Result.Width = It->second.Width;
+        Result.Height = It->second.Height;
+        Result.Pixels = It->second.Pixels.data();
+    }
+
+    return Result;
+}
+
+void SetThreadCount(uint32_t Count)
+{
+    if (Count != g_ThreadCount)
+    {
+        g_Pool.reset();
+    }
+
+    g_ThreadCount = Count;
+}
+
+uint32_t ThreadCount()
+{
+    return ResolveThreadCount();
+}
+
+}
+}
@@ -0,0 +1,77 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "OctaneGUI/Mouse.h"
+
+#include <cstdint>
+
+namespace OctaneGUI
+{
+
+class Event;
+class Window;
+
+}
+
+namespace Frontend
+{
+namespace Windowing
+{
+
+/// @brief Queues an event to be returned for the given window on the next frame.
+///
+/// Events for a window are returned in the order they were queued.
+void QueueEvent(OctaneGUI::Window* Window, const OctaneGUI::Event& Value);
+
+/// @brief Loads an input script, which is a JSON object with an 'Events' array.
+///
+/// The format of the script is described by OctaneGUI::EventScript. Events are queued starting
+/// with the next frame, or after the last event of a script that is still running. The file
+/// named by the OCTANEGUI_SCRIPT environment variable is loaded when the frontend is initialized.
+///
+/// @param Stream The JSON contents of the script.
+/// @return False if the script could not be parsed.
+bool LoadScript(const char* Stream);
+
+/// @brief Whether every event from the loaded scripts has been queued.
+bool ScriptFinished();
+
+/// @brief Closes the 'Main' window once the given number of frames have run.
+///
+/// Zero, the default, runs until the application is closed by other means. The limit is read
+/// from the OCTANEGUI_FRAME_LIMIT environment variable when the frontend is initialized.
+void SetFrameLimit(uint64_t Frames);
+
+/// @brief Number of frames that have started since the frontend was initialized.
+uint64_t FrameCount();
+
+/// @brief The last cursor requested for the given window.
+OctaneGUI::Mouse::Cursor GetMouseCursor(OctaneGUI::Window* Window);
+
+}
+}
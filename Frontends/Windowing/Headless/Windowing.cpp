@@ -0,0 +1,271 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "../Windowing.h"
+#include "Interface.h"
+#include "OctaneGUI/OctaneGUI.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Frontend
+{
+namespace Windowing
+{
+
+#define POLL_INTERVAL_MS 10
+
+struct Container
+{
+public:
+    std::deque<OctaneGUI::Event> Events {};
+    OctaneGUI::Mouse::Cursor Cursor { OctaneGUI::Mouse::Cursor::Arrow };
+};
+
+std::unordered_map<OctaneGUI::Window*, Container> g_Windows;
+std::deque<OctaneGUI::EventScript::Item> g_Script;
+std::u32string g_Clipboard;
+uint64_t g_Frame { 0 };
+uint64_t g_FrameLimit { 0 };
+
+OctaneGUI::Window* FindWindow(const std::string& ID)
+{
+    for (const std::pair<OctaneGUI::Window* const, Container>& Item : g_Windows)
+    {
+        if (ID == Item.first->ID())
+        {
+            return Item.first;
+        }
+    }
+
+    return nullptr;
+}
+
+bool Initialize()
+{
+    g_Frame = 0;
+
+    // Any app can be run from a script without changing its code. OCTANEGUI_SCRIPT is the path of a
+    // script to load and OCTANEGUI_FRAME_LIMIT is the number of frames to run before closing.
+    const char* ScriptPath = std::getenv("OCTANEGUI_SCRIPT");
+    if (ScriptPath != nullptr && *ScriptPath != '\0')
+    {
+        std::ifstream File(ScriptPath);
+        std::stringstream Stream;
+        Stream << File.rdbuf();
+        if (!File.is_open() || !LoadScript(Stream.str().c_str()))
+        {
+            printf("Failed to load script '%s'.\n", ScriptPath);
+            return false;
+        }
+    }
+
+    const char* FrameLimit = std::getenv("OCTANEGUI_FRAME_LIMIT");
+    if (FrameLimit != nullptr)
+    {
+        SetFrameLimit(std::strtoull(FrameLimit, nullptr, 10));
+    }
+
+    return true;
+}
+
+void NewWindow(OctaneGUI::Window* Window)
+{
+    g_Windows[Window];
+}
+
+void DestroyWindow(OctaneGUI::Window* Window)
+{
+    g_Windows.erase(Window);
+}
+
+void RaiseWindow(OctaneGUI::Window* Window)
+{
+}
+
+void MinimizeWindow(OctaneGUI::Window* Window)
+{
+}
+
+void MaximizeWindow(OctaneGUI::Window* Window)
+{
+}
+
+void ToggleWindow(OctaneGUI::Window* Window, bool Enable)
+{
+}
+
+void NewFrame()
+{
+    g_Frame++;
+
+    while (!g_Script.empty() && g_Script.front().Frame <= g_Frame)
+    {
+        const OctaneGUI::EventScript::Item& Item = g_Script.front();
+        OctaneGUI::Window* Target = FindWindow(Item.Window);
+        if (Target != nullptr)
+        {
+            g_Windows[Target].Events.push_back(Item.Value);
+        }
+        g_Script.pop_front();
+    }
+
+    if (g_FrameLimit > 0 && g_Frame == g_FrameLimit + 1)
+    {
+        OctaneGUI::Window* Main = FindWindow("Main");
+        if (Main != nullptr)
+        {
+            g_Windows[Main].Events.push_back(OctaneGUI::Event(OctaneGUI::Event::Type::WindowClosed));
+        }
+    }
+}
+
+OctaneGUI::Event Event(OctaneGUI::Window* Window)
+{
+    const std::unordered_map<OctaneGUI::Window*, Container>::iterator It = g_Windows.find(Window);
+    if (It == g_Windows.end() || It->second.Events.empty())
+    {
+        return OctaneGUI::Event(OctaneGUI::Event::Type::None);
+    }
+
+    const OctaneGUI::Event Result = It->second.Events.front();
+    It->second.Events.pop_front();
+    return Result;
+}
+
+void WaitEvent(int Timeout)
+{
+    // Scripted runs advance to the next frame right away instead of waiting on real time.
+    if (!g_Script.empty() || g_FrameLimit > 0)
+    {
+        return;
+    }
+
+    for (const std::pair<OctaneGUI::Window* const, Container>& Item : g_Windows)
+    {
+        if (!Item.second.Events.empty())
+        {
+            return;
+        }
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(Timeout < 0 ? POLL_INTERVAL_MS : std::min(Timeout, POLL_INTERVAL_MS)));
+}
+
+void Exit()
+{
+    g_Windows.clear();
+    g_Script.clear();
+    g_Clipboard.clear();
+    g_FrameLimit = 0;
+}
+
+void SetClipboardContents(const std::u32string& Contents)
+{
+    g_Clipboard = Contents;
+}
+
+std::u32string GetClipboardContents()
+{
+    return g_Clipboard;
+}
+
+void SetWindowTitle(OctaneGUI::Window* Window, const char* Title)
+{
+}
+
+void SetWindowPosition(OctaneGUI::Window* Window)
+{
+}
+
+void SetWindowSize(OctaneGUI::Window* Window)
+{
+}
+
+void SetMouseCursor(OctaneGUI::Window* Window, OctaneGUI::Mouse::Cursor Cursor)
+{
+    const std::unordered_map<OctaneGUI::Window*, Container>::iterator It = g_Windows.find(Window);
+    if (It != g_Windows.end())
+    {
+        It->second.Cursor = Cursor;
+    }
+}
+
+void QueueEvent(OctaneGUI::Window* Window, const OctaneGUI::Event& Value)
+{
+    g_Windows[Window].Events.push_back(Value);
+}
+
+bool LoadScript(const char* Stream)
+{
+    bool IsError = false;
+    const OctaneGUI::Json Root = OctaneGUI::Json::Parse(Stream, IsError);
+    if (IsError || !Root["Events"].IsArray())
+    {
+        return false;
+    }
+
+    // Scripts loaded while another is still running continue after its last event.
+    uint64_t Frame = g_Script.empty() ? g_Frame + 1 : g_Script.back().Frame;
+    std::vector<OctaneGUI::EventScript::Item> Items;
+    const bool Result = OctaneGUI::EventScript::Parse(Root, Frame, Items);
+    g_Script.insert(g_Script.end(), Items.begin(), Items.end());
+
+    return Result;
+}
+
+bool ScriptFinished()
+{
+    return g_Script.empty();
+}
+
+void SetFrameLimit(uint64_t Frames)
+{
+    g_FrameLimit = Frames;
+}
+
+uint64_t FrameCount()
+{
+    return g_Frame;
+}
+
+OctaneGUI::Mouse::Cursor GetMouseCursor(OctaneGUI::Window* Window)
+{
+    const std::unordered_map<OctaneGUI::Window*, Container>::const_iterator It = g_Windows.find(Window);
+    return It != g_Windows.end() ? It->second.Cursor : OctaneGUI::Mouse::Cursor::Arrow;
+}
+
+}
+}
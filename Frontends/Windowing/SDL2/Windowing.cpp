@@ -613,6 +613,28 @@ OctaneGUI::Event Event(OctaneGUI::Window* Window)
     return OctaneGUI::Event(OctaneGUI::Event::Type::None);
 }
 
+void WaitEvent(int Timeout)
+{
+    // Events queued for other windows while polling are already available.
+    for (const std::pair<const uint32_t, std::vector<SDL_Event>>& Item : g_UnhandledEvents)
+    {
+        if (!Item.second.empty())
+        {
+            return;
+        }
+    }
+
+    // Passing a null event leaves the event in the queue to be handled by the next poll.
+    if (Timeout < 0)
+    {
+        SDL_WaitEvent(nullptr);
+    }
+    else
+    {
+        SDL_WaitEventTimeout(nullptr, Timeout);
+    }
+}
+
 void Exit()
 {
     for (const std::pair<SDL_SystemCursor, SDL_Cursor*>& SystemCursor : g_SystemCursors)
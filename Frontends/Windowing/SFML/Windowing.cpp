@@ -28,7 +28,10 @@ SOFTWARE.
 #include "OctaneGUI/OctaneGUI.h"
 #include "SFML/Graphics.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <unordered_map>
 
 #if defined(WINDOWS)
@@ -41,11 +44,13 @@ namespace Windowing
 {
 
 #define MULTI_CLICK_TIME_MS 300
+#define POLL_INTERVAL_MS 10
 
 std::unordered_map<OctaneGUI::Window*, std::shared_ptr<sf::RenderWindow>> g_Windows {};
 OctaneGUI::Clock g_MouseButtonClock {};
 std::unordered_map<OctaneGUI::Mouse::Button, uint8_t> g_MouseClicks {};
 std::unordered_map<sf::Cursor::Type, sf::Cursor> g_Cursors;
+std::unordered_map<OctaneGUI::Window*, sf::Event> g_WaitedEvents {};
 
 OctaneGUI::Keyboard::Key GetKeyCode(sf::Keyboard::Key Key)
 {
@@ -198,6 +203,7 @@ void DestroyWindow(OctaneGUI::Window* Window)
 
     g_Windows[Window]->close();
     g_Windows.erase(Window);
+    g_WaitedEvents.erase(Window);
 }
 
 void RaiseWindow(OctaneGUI::Window* Window)
@@ -283,7 +289,20 @@ OctaneGUI::Event Event(OctaneGUI::Window* Window)
     const std::shared_ptr<sf::RenderWindow>& RenderWindow = g_Windows[Window];
 
     sf::Event Event;
-    if (RenderWindow->pollEvent(Event))
+    bool HasEvent = false;
+    const std::unordered_map<OctaneGUI::Window*, sf::Event>::iterator Waited = g_WaitedEvents.find(Window);
+    if (Waited != g_WaitedEvents.end())
+    {
+        Event = Waited->second;
+        g_WaitedEvents.erase(Waited);
+        HasEvent = true;
+    }
+    else
+    {
+        HasEvent = RenderWindow->pollEvent(Event);
+    }
+
+    if (HasEvent)
     {
         switch (Event.type)
         {
@@ -379,6 +398,29 @@ OctaneGUI::Event Event(OctaneGUI::Window* Window)
     return OctaneGUI::Event(OctaneGUI::Event::Type::None);
 }
 
+void WaitEvent(int Timeout)
+{
+    // An event from a previous wait has not been handled yet.
+    if (!g_WaitedEvents.empty())
+    {
+        return;
+    }
+
+    // SFML can only block on the events of a single window and without a timeout. The event
+    // is held until the next call to Event. Otherwise, the windows are polled at an interval.
+    if (Timeout < 0 && g_Windows.size() == 1)
+    {
+        sf::Event Event;
+        if (g_Windows.begin()->second->waitEvent(Event))
+        {
+            g_WaitedEvents[g_Windows.begin()->first] = Event;
+        }
+        return;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(Timeout < 0 ? POLL_INTERVAL_MS : std::min(Timeout, POLL_INTERVAL_MS)));
+}
+
 void Exit()
 {
     for (const std::pair<OctaneGUI::Window*, std::shared_ptr<sf::RenderWindow>>& Item : g_Windows)
@@ -387,6 +429,7 @@ void Exit()
     }
 
     g_Windows.clear();
+    g_WaitedEvents.clear();
 }
 
 void SetClipboardContents(const std::u32string& Contents)
@@ -71,6 +71,7 @@ void MaximizeWindow(OctaneGUI::Window* Window);
 void ToggleWindow(OctaneGUI::Window* Window, bool Enable);
 void NewFrame();
 OctaneGUI::Event Event(OctaneGUI::Window* Window);
+void WaitEvent(int Timeout);
 void Exit();
 void SetClipboardContents(const std::u32string& Contents);
 std::u32string GetClipboardContents();
@@ -8,6 +8,8 @@ SET BUILD_TOOLS=OFF
 SET CLEAN=FALSE
 SET WINDOWING=SFML
 SET RENDERING=SFML
+SET SOFTWARE=FALSE
+SET HEADLESS=FALSE
 SET NO_APPS=OFF
 SET HELP=FALSE
 
@@ -21,6 +23,8 @@ IF NOT "%1" == "" (
     IF /I "%1" == "Tools" SET BUILD_TOOLS=ON
     IF /I "%1" == "SDL2" SET SDL2=TRUE
     IF /I "%1" == "SFML" SET SFML=TRUE
+    IF /I "%1" == "SOFTWARE" SET SOFTWARE=TRUE
+    IF /I "%1" == "HEADLESS" SET HEADLESS=TRUE
     IF /I "%1" == "NINJA" SET NINJA=TRUE
     IF /I "%1" == "CLEAN" SET CLEAN=TRUE
     IF /I "%1" == "NOAPPS" SET NO_APPS=ON
@@ -41,6 +45,15 @@ IF "%SFML%" == "TRUE" (
     SET SDL2=FALSE
 )
 
+IF "%SOFTWARE%" == "TRUE" (
+    SET RENDERING=Software
+)
+
+IF "%HEADLESS%" == "TRUE" (
+    SET WINDOWING=Headless
+    SET RENDERING=Software
+)
+
 IF "%NINJA%" == "TRUE" (
     SET GENERATOR=Ninja
 )
@@ -59,6 +72,9 @@ IF "%HELP%" == "TRUE" (
     ECHO sdl2           Builds the app using the SDL library. The SDL2 cmake and library paths must
     ECHO                be locatable by the generator through either the environment variables or the 
     ECHO                SDL2_DIR and SDL2_MODULE_PATH variables.
+    ECHO software       Renders on the CPU into an in-memory framebuffer instead of using the GPU.
+    ECHO headless       Runs the apps without creating any windows. Events are read from scripts and
+    ECHO                frames are rendered with the software renderer.
     ECHO help           Displays this help message.
     EXIT 0
 )
@@ -8,6 +8,8 @@ CONFIGURATION=Debug
 TOOLS=OFF
 WINDOWING=SDL2
 RENDERING=OpenGL
+SOFTWARE=false
+HEADLESS=false
 CLEAN=false
 NO_APPS=OFF
 HELP=false
@@ -24,6 +26,8 @@ do
         tools) TOOLS=ON ;;
         sfml) SFML=true && SDL2=false ;;
         sdl2) SDL2=true ;;
+        software) SOFTWARE=true ;;
+        headless) HEADLESS=true ;;
         ninja) NINJA=true ;;
         clean) CLEAN=true ;;
         noapps) NO_APPS=ON ;;
@@ -48,6 +52,15 @@ if [[ $OSTYPE == "darwin"* ]]; then
     fi
 fi
 
+if [ "$SOFTWARE" = true ] ; then
+    RENDERING=Software
+fi
+
+if [ "$HEADLESS" = true ] ; then
+    WINDOWING=Headless
+    RENDERING=Software
+fi
+
 if [ "$NINJA" = true ] ; then
     GENERATOR=Ninja
 fi
@@ -66,6 +79,9 @@ if [ "$HELP" = true ] ; then
     echo "sdl2           Builds the app using the SDL library. The SDL2 cmake and library paths must"
     echo "               be locatable by the generator through either the environment variables or the "
     echo "               SDL2_DIR and SDL2_MODULE_PATH variables."
+    echo "software       Renders on the CPU into an in-memory framebuffer instead of using the GPU."
+    echo "headless       Runs the apps without creating any windows. Events are read from scripts and"
+    echo "               frames are rendered with the software renderer."
     echo "help           Displays this help message."
     exit 0
 fi
@@ -30,10 +30,11 @@ SOFTWARE.
 #include "Controls/ControlList.h"
 #include "Controls/WindowContainer.h"
 #include "Event.h"
+#include "Font.h"
 #include "Icons.h"
 #include "Json.h"
-#include "Paint.h"
 #include "Profiler.h"
+#include "TaskPool.h"
 #include "Texture.h"
 #include "Theme.h"
 #include "Window.h"
@@ -46,21 +47,35 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+Application* Application::s_Current { nullptr };
+
 Application::Application()
+    : m_Previous(s_Current)
 {
-    Texture::SetOnLoad([this](const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height) -> uint32_t
-        {
-            if (m_OnLoadTexture)
-            {
-                return m_OnLoadTexture(Data, Width, Height);
-            }
-
-            return 0;
-        });
+    s_Current = this;
+    BindTextures();
 }
 
 Application::~Application()
 {
+    // An application created while another one exists, such as one run by a test, gives the
+    // textures back to the previous application once it is destroyed.
+    if (s_Current != this)
+    {
+        return;
+    }
+
+    s_Current = m_Previous;
+    if (s_Current != nullptr)
+    {
+        s_Current->BindTextures();
+    }
+    else
+    {
+        Texture::SetOnLoad(nullptr);
+        Texture::SetOnUpdate(nullptr);
+        Texture::SetOnUnload(nullptr);
+    }
 }
 
 bool Application::Initialize(const char* JsonStream, std::unordered_map<std::string, ControlList>& WindowControls)
@@ -102,22 +117,38 @@ bool Application::Initialize(const char* JsonStream, std::unordered_map<std::str
     Assert(m_Windows.find("Main") != m_Windows.end(), "No 'Main' window defined!");
     DisplayWindow("Main");
 
+    // The page size needs to be set before any textures that should share pages are loaded.
+    Texture::SetAtlasPageSize((uint32_t)Root["TextureAtlasPageSize"].Number(0.0f));
+
+    // Icons and theme fonts are rasterized on worker threads. Only the textures are
+    // created on this thread once all of them are finished.
+    TaskPool Pool;
+
     m_Icons = std::make_shared<Icons>();
     const Json& IconsObject = Root["Icons"];
     if (!IconsObject.IsNull() && !IconsObject["File"].IsNull())
     {
         const std::string Contents = FS().LoadContents(IconsObject["File"].String());
         const Json Loaded = Json::Parse(Contents.c_str());
-        LoadIcons(Loaded);
+        LoadIcons(Loaded, Pool);
     }
     else
     {
-        LoadIcons(IconsObject);
+        LoadIcons(IconsObject, Pool);
     }
 
-    m_Theme->Load(Root["Theme"]);
+    const char* FontCache = Root["FontCache"].String(nullptr);
+    if (FontCache != nullptr)
+    {
+        Font::SetCacheDirectory(FontCache);
+    }
+
+    m_Theme->Load(Root["Theme"], Pool);
     Assert(m_Theme->GetFont() != nullptr, "No font loaded with theme!");
 
+    Pool.Wait();
+    m_Icons->Upload();
+
     m_FileSystem.SetUseSystemFileDialog(Root["UseSystemFileDialog"].Boolean());
 
     // Now load the contents for each window. Some of the controls may require
@@ -145,6 +176,7 @@ void Application::Shutdown()
     m_Windows.clear();
     m_Theme = nullptr;
     m_Icons = nullptr;
+    Texture::SetAtlasPageSize(0);
     m_IsRunning = false;
 
     if (m_OnExit)
@@ -167,8 +199,7 @@ void Application::Update()
     {
         if (Item.second->IsVisible())
         {
-            Paint Brush(m_Theme);
-            Item.second->DoPaint(Brush);
+            Item.second->DoPaint();
         }
     }
 
@@ -218,10 +249,9 @@ int Application::Run()
 
             Update();
 
-            if (EventsProcessed <= 0)
+            if (EventsProcessed <= 0 && m_IsRunning)
             {
-                PROFILER_SAMPLE("Sleep");
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                WaitEvent();
             }
         }
     }
@@ -494,6 +524,18 @@ Application& Application::SetOnPaint(OnWindowPaintSignature&& Fn)
     return *this;
 }
 
+Application& Application::SetOnPaintRegion(OnWindowPaintRegionSignature&& Fn)
+{
+    m_OnPaintRegion = std::move(Fn);
+
+    for (const std::pair<const std::string, std::shared_ptr<Window>>& Item : m_Windows)
+    {
+        BindPaintRegion(Item.second);
+    }
+
+    return *this;
+}
+
 Application& Application::SetOnNewFrame(OnEmptySignature&& Fn)
 {
     m_OnNewFrame = std::move(Fn);
@@ -506,12 +548,31 @@ Application& Application::SetOnEvent(OnWindowEventSignature&& Fn)
     return *this;
 }
 
+Application& Application::SetOnWaitEvent(OnWaitEventSignature&& Fn)
+{
+    m_OnWaitEvent = std::move(Fn);
+    return *this;
+}
+
 Application& Application::SetOnLoadTexture(OnLoadTextureSignature&& Fn)
 {
     m_OnLoadTexture = std::move(Fn);
     return *this;
 }
 
+Application& Application::SetOnUpdateTexture(OnUpdateTextureSignature&& Fn)
+{
+    m_OnUpdateTexture = std::move(Fn);
+    BindTextures();
+    return *this;
+}
+
+Application& Application::SetOnUnloadTexture(OnUnloadTextureSignature&& Fn)
+{
+    m_OnUnloadTexture = std::move(Fn);
+    return *this;
+}
+
 Application& Application::SetOnExit(OnEmptySignature&& Fn)
 {
     m_OnExit = std::move(Fn);
@@ -542,6 +603,41 @@ Application& Application::SetOnSetMouseCursor(OnSetMouseCursorSignature&& Fn)
     return *this;
 }
 
+void Application::BindTextures()
+{
+    Texture::SetOnLoad([this](const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height) -> uint32_t
+        {
+            if (m_OnLoadTexture)
+            {
+                return m_OnLoadTexture(Data, Width, Height);
+            }
+
+            return 0;
+        });
+
+    Texture::SetOnUnload([this](uint32_t ID) -> void
+        {
+            if (m_OnUnloadTexture)
+            {
+                m_OnUnloadTexture(ID);
+            }
+        });
+
+    // Textures are only updated when the frontend supports it, so the texture atlas knows
+    // whether images can be copied into its pages.
+    if (m_OnUpdateTexture)
+    {
+        Texture::SetOnUpdate([this](uint32_t ID, const std::vector<uint8_t>& Data, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height) -> void
+            {
+                m_OnUpdateTexture(ID, Data, X, Y, Width, Height);
+            });
+    }
+    else
+    {
+        Texture::SetOnUpdate(nullptr);
+    }
+}
+
 void Application::OnPaint(Window* InWindow, const VertexBuffer& Buffers)
 {
     if (m_OnPaint)
@@ -550,6 +646,27 @@ void Application::OnPaint(Window* InWindow, const VertexBuffer& Buffers)
     }
 }
 
+void Application::OnPaintRegion(Window* InWindow, const VertexBuffer& Buffer, const std::vector<Rect>& Damage)
+{
+    if (m_OnPaintRegion)
+    {
+        m_OnPaintRegion(InWindow, Buffer, Damage);
+    }
+}
+
+void Application::BindPaintRegion(const std::shared_ptr<Window>& Item)
+{
+    // Windows only paint partial regions if the frontend is able to handle them.
+    if (m_OnPaintRegion)
+    {
+        Item->SetOnPaintRegion(std::bind(&Application::OnPaintRegion, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+    }
+    else
+    {
+        Item->SetOnPaintRegion(nullptr);
+    }
+}
+
 std::shared_ptr<Window> Application::CreateWindow(const char* ID)
 {
     std::shared_ptr<Window> Result = std::make_shared<Window>(this);
@@ -558,6 +675,7 @@ std::shared_ptr<Window> Application::CreateWindow(const char* ID)
     Result->SetCustomTitleBar(m_CustomTitleBar);
     Result->CreateContainer();
     Result->SetOnPaint(std::bind(&Application::OnPaint, this, std::placeholders::_1, std::placeholders::_2));
+    BindPaintRegion(Result);
     Result->SetID(ID);
     return Result;
 }
@@ -651,6 +769,17 @@ int Application::ProcessEvent(const std::shared_ptr<Window>& Item)
         }
     }
 
+    return DispatchEvent(Item, E);
+}
+
+int Application::DispatchEvent(const std::shared_ptr<Window>& Item, const Event& E)
+{
+    if (!Item)
+    {
+        return 0;
+    }
+
+    int Processed = 0;
     m_EventFocus = Item;
 
     Processed++;
@@ -733,6 +862,45 @@ int Application::ProcessEvent(const std::shared_ptr<Window>& Item)
     return Processed;
 }
 
+void Application::WaitEvent() const
+{
+    PROFILER_SAMPLE("WaitEvent");
+
+    // Nothing needs to happen until either an event arrives or the next timer is due. Windows
+    // with a pending layout or repaint only poll for events so they are handled right away.
+    int Timeout = -1;
+    for (const auto& Item : m_Windows)
+    {
+        if (!Item.second->IsVisible())
+        {
+            continue;
+        }
+
+        if (Item.second->HasPendingWork())
+        {
+            Timeout = 0;
+            break;
+        }
+
+        const int Next = Item.second->NextTimerTimeout();
+        if (Next >= 0 && (Timeout < 0 || Next < Timeout))
+        {
+            Timeout = Next;
+        }
+    }
+
+    if (m_OnWaitEvent)
+    {
+        m_OnWaitEvent(Timeout);
+    }
+    else
+    {
+        // Frontends that are not able to block on events are polled instead.
+        const int PollInterval = 10;
+        std::this_thread::sleep_for(std::chrono::milliseconds(Timeout < 0 ? PollInterval : std::min(Timeout, PollInterval)));
+    }
+}
+
 bool Application::Initialize()
 {
     if (m_IsRunning)
@@ -763,7 +931,7 @@ void Application::OnWindowAction(Window* InWindow, WindowAction Action)
     }
 }
 
-void Application::LoadIcons(const Json& Root)
+void Application::LoadIcons(const Json& Root, TaskPool& Pool)
 {
     if (Root.IsNull() || Root["UseBitmap"].Boolean())
     {
@@ -782,7 +950,7 @@ void Application::LoadIcons(const Json& Root)
             Definitions.push_back({ Item["Type"].String(), Item["FileName"].String() });
         }
 
-        m_Icons->Initialize(Definitions, IconSize);
+        m_Icons->Initialize(Definitions, IconSize, Pool);
     }
 }
 
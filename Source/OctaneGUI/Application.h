@@ -30,6 +30,7 @@ SOFTWARE.
 #include "FileSystem.h"
 #include "Keyboard.h"
 #include "Mouse.h"
+#include "Rect.h"
 #include "TextureCache.h"
 #include "Vector2.h"
 
@@ -49,6 +50,7 @@ class ControlList;
 class Event;
 class Icons;
 class Json;
+class TaskPool;
 class Theme;
 class VertexBuffer;
 class Window;
@@ -84,9 +86,13 @@ class Application
 public:
     typedef std::function<void(Window*)> OnWindowSignature;
     typedef std::function<void(Window*, const VertexBuffer&)> OnWindowPaintSignature;
+    typedef std::function<void(Window*, const VertexBuffer&, const std::vector<Rect>&)> OnWindowPaintRegionSignature;
     typedef std::function<Event(Window*)> OnWindowEventSignature;
+    typedef std::function<void(int)> OnWaitEventSignature;
     typedef std::function<void(Window*, WindowAction)> OnWindowActionSignature;
     typedef std::function<uint32_t(const std::vector<uint8_t>&, uint32_t, uint32_t)> OnLoadTextureSignature;
+    typedef std::function<void(uint32_t, const std::vector<uint8_t>&, uint32_t, uint32_t, uint32_t, uint32_t)> OnUpdateTextureSignature;
+    typedef std::function<void(uint32_t)> OnUnloadTextureSignature;
     typedef std::function<void(const std::u32string&)> OnSetClipboardContentsSignature;
     typedef std::function<std::u32string(void)> OnGetClipboardContentsSignature;
     typedef std::function<void(Window*, const char*)> OnSetWindowTitleSignature;
@@ -110,6 +116,10 @@ public:
     /// * CustomTitleBar: Forces all windows to be created with no system title bar.
     /// * UseSystemFileDialog: Notifies the FileSystem object to use the system's file dialog instead
     /// of the custom one using the libraries controls.
+    /// * FontCache: Directory to cache baked font atlases in to speed up later launches.
+    /// * TextureAtlasPageSize: Size of the shared pages that fonts, icons and images from the
+    /// TextureCache are packed into so they can be drawn without switching textures. Zero or
+    /// not defined gives each of these a texture of its own.
     ///
     /// The second parameter is a reference to a map<string, ControlList>, which returns all controls
     /// that has a 'ID' property in their JSON for their respective window defined by a string.
@@ -154,6 +164,15 @@ public:
     /// @return std::shared_ptr<Window> object.
     std::shared_ptr<Window> GetWindow(const char* ID) const;
 
+    /// @brief Forwards an event to a window the same way events from the frontend are handled.
+    ///
+    /// This is useful for playing back recorded or scripted input without a frontend.
+    ///
+    /// @param Item The window that receives the event.
+    /// @param E The event to dispatch.
+    /// @return The number of events that were handled.
+    int DispatchEvent(const std::shared_ptr<Window>& Item, const Event& E);
+
     /// @cond !IGNORE_FUNCTIONS
     /// @brief Used internally.
     std::shared_ptr<Window> EventFocus() const;
@@ -282,6 +301,18 @@ public:
     /// @return The Application object to allow for chaining methods.
     Application& SetOnPaint(OnWindowPaintSignature&& Fn);
 
+    /// @brief Optional partial window paint notification that can be handled by the frontend.
+    ///
+    /// If this callback is given, a Window that only needs to repaint a few controls will
+    /// invoke this callback instead of the one given to SetOnPaint. The buffer will only
+    /// contain the controls that overlap the given list of damaged regions. The frontend
+    /// must only update the pixels within these regions and preserve the rest of the
+    /// previously presented frame.
+    ///
+    /// @param Fn The OnWindowPaintRegionSignature callback.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetOnPaintRegion(OnWindowPaintRegionSignature&& Fn);
+
     /// @brief Notification for when a new frame begins.
     ///
     /// A new frame occurs during a Run loop whenever a new iteration begins and
@@ -301,6 +332,18 @@ public:
     /// @return The Application object to allow for chaining methods.
     Application& SetOnEvent(OnWindowEventSignature&& Fn);
 
+    /// @brief Request for the frontend to block until a system event is available.
+    ///
+    /// This callback is invoked during the Run loop when no events were processed
+    /// for a frame. The frontend should return as soon as an event is available for
+    /// any Window or once the timeout has passed, without removing the event. The
+    /// timeout is the time until the next Window timer is due, or -1 if no timers are
+    /// running. If no callback is given, the Run loop sleeps for up to 10 milliseconds.
+    ///
+    /// @param Fn The OnWaitEventSignature callback. The argument is the timeout in milliseconds.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetOnWaitEvent(OnWaitEventSignature&& Fn);
+
     /// @brief Request for the frontend to load a texture.
     ///
     /// This callback is invoked whenever the library makes a request to load
@@ -310,6 +353,25 @@ public:
     /// @return The Application object to allow for chaining methods.
     Application& SetOnLoadTexture(OnLoadTextureSignature&& Fn);
 
+    /// @brief Request for the frontend to replace a region of a loaded texture.
+    ///
+    /// This callback is invoked when the library only needs to upload part of
+    /// a texture, such as a glyph added to a font atlas. The pixel data only
+    /// contains the region being replaced.
+    ///
+    /// @param Fn The OnUpdateTextureSignature callback.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetOnUpdateTexture(OnUpdateTextureSignature&& Fn);
+
+    /// @brief Request for the frontend to release a loaded texture.
+    ///
+    /// This callback is invoked when the library no longer draws with a texture,
+    /// such as a font atlas that was replaced by a larger one.
+    ///
+    /// @param Fn The OnUnloadTextureSignature callback.
+    /// @return The Application object to allow for chaining methods.
+    Application& SetOnUnloadTexture(OnUnloadTextureSignature&& Fn);
+
     /// @brief Callback invoked when the application is exiting.
     ///
     /// This is a good time for the frontend to cleanup any allocated
@@ -346,13 +408,20 @@ public:
     Application& SetOnSetMouseCursor(OnSetMouseCursorSignature&& Fn);
 
 private:
+    // The application most recently created. Textures are loaded through it.
+    static Application* s_Current;
+
+    void BindTextures();
     void OnPaint(Window* InWindow, const VertexBuffer& Buffer);
+    void OnPaintRegion(Window* InWindow, const VertexBuffer& Buffer, const std::vector<Rect>& Damage);
+    void BindPaintRegion(const std::shared_ptr<Window>& Item);
     std::shared_ptr<Window> CreateWindow(const char* ID);
     void DestroyWindow(const std::shared_ptr<Window>& Item);
     int ProcessEvent(const std::shared_ptr<Window>& Item);
+    void WaitEvent() const;
     bool Initialize();
     void OnWindowAction(Window* InWindow, WindowAction Action);
-    void LoadIcons(const Json& Root);
+    void LoadIcons(const Json& Root, TaskPool& Pool);
     void FocusWindow(const std::shared_ptr<Window>& Focus);
 
     std::unordered_map<std::string, std::shared_ptr<Window>> m_Windows;
@@ -366,6 +435,7 @@ private:
     FileSystem m_FileSystem { *this };
     bool m_HighDPI { true };
     bool m_CustomTitleBar { false };
+    Application* m_Previous { nullptr };
 
 #if TOOLS
     bool m_IgnoreModals { false };
@@ -374,9 +444,13 @@ private:
 
     OnWindowActionSignature m_OnWindowAction { nullptr };
     OnWindowPaintSignature m_OnPaint { nullptr };
+    OnWindowPaintRegionSignature m_OnPaintRegion { nullptr };
     OnEmptySignature m_OnNewFrame { nullptr };
     OnWindowEventSignature m_OnEvent { nullptr };
+    OnWaitEventSignature m_OnWaitEvent { nullptr };
     OnLoadTextureSignature m_OnLoadTexture { nullptr };
+    OnUpdateTextureSignature m_OnUpdateTexture { nullptr };
+    OnUnloadTextureSignature m_OnUnloadTexture { nullptr };
     OnEmptySignature m_OnExit { nullptr };
     OnSetClipboardContentsSignature m_OnSetClipboardContents { nullptr };
     OnGetClipboardContentsSignature m_OnGetClipboardContents { nullptr };
@@ -60,10 +60,6 @@ Json Color::ToJson(const Color& Value)
     return std::move(Result);
 }
 
-Color::Color()
-{
-}
-
 Color::Color(uint8_t InR, uint8_t InG, uint8_t InB, uint8_t InA)
     : R(InR)
     , G(InG)
@@ -47,7 +47,7 @@ public:
     uint8_t B { 0 };
     uint8_t A { 0 };
 
-    Color();
+    Color() = default;
     Color(uint8_t InR, uint8_t InG, uint8_t InB, uint8_t InA);
 
     bool operator==(const Color& Other) const;
@@ -80,6 +80,7 @@ Grow BoxContainer::GrowDirection() const
 BoxContainer* BoxContainer::SetSpacing(const Vector2& Spacing)
 {
     m_Spacing = Spacing;
+    InvalidateDesiredSize();
     return this;
 }
 
@@ -91,6 +92,7 @@ Vector2 BoxContainer::Spacing() const
 BoxContainer& BoxContainer::SetIgnoreDesiredSize(bool IgnoreDesiredSize)
 {
     m_IgnoreDesiredSize = IgnoreDesiredSize;
+    InvalidateDesiredSize();
     return *this;
 }
 
@@ -106,12 +108,17 @@ Vector2 BoxContainer::DesiredSize() const
         return Container::DesiredSize();
     }
 
+    if (IsDesiredSizeCached())
+    {
+        return CachedDesiredSize();
+    }
+
     Vector2 Result;
 
     for (const std::shared_ptr<Control>& Item : Controls())
     {
         Vector2 Size = Item->GetSize();
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Container::Cast(Item.get());
         if (ItemContainer)
         {
             Size = ItemContainer->DesiredSize();
@@ -129,7 +136,7 @@ Vector2 BoxContainer::DesiredSize() const
         }
     }
 
-    return Result;
+    return CacheDesiredSize(Result);
 }
 
 void BoxContainer::OnLoad(const Json& Root)
@@ -138,6 +145,7 @@ void BoxContainer::OnLoad(const Json& Root)
 
     m_Grow = ToGrow(Root["Grow"].String());
     m_Spacing = Variant(Root["Spacing"]).Vector(m_Spacing);
+    InvalidateDesiredSize();
 }
 
 void BoxContainer::OnSave(Json& Root) const
@@ -160,18 +168,22 @@ void BoxContainer::PlaceControls(const std::vector<std::shared_ptr<Control>>& Co
     int ExpandH = 0;
     const Vector2 TotalSpacing = m_Spacing * (float)(Controls.size() > 0 ? Controls.size() - 1 : 0);
     Vector2 AvailableSize = GetSize() - TotalSpacing;
-    std::unordered_map<Control*, Vector2> DesiredSizes;
+
+    // Desired sizes are stored by child index in a scratch array owned by this container so that
+    // repeated layouts do not allocate.
+    m_DesiredSizes.clear();
+    m_DesiredSizes.reserve(Controls.size());
     for (const std::shared_ptr<Control>& Item : Controls)
     {
         Vector2 Size = Item->GetSize();
 
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Container::Cast(Item.get());
         if (ItemContainer)
         {
             Size = ItemContainer->DesiredSize();
         }
 
-        DesiredSizes[Item.get()] = Size;
+        m_DesiredSizes.push_back(Size);
 
         switch (Item->GetExpand())
         {
@@ -228,9 +240,10 @@ void BoxContainer::PlaceControls(const std::vector<std::shared_ptr<Control>>& Co
     //	  TODO: Mayby check if AvailableSize is zero and size any left over controls to zero?
     Vector2 TotalSize = TotalSpacing;
     AvailableSize = GetSize();
-    for (const std::shared_ptr<Control>& Item : Controls)
+    for (size_t I = 0; I < Controls.size(); I++)
     {
-        Vector2 Size = DesiredSizes[Item.get()];
+        const std::shared_ptr<Control>& Item = Controls[I];
+        Vector2 Size = m_DesiredSizes[I];
 
         switch (Item->GetExpand())
         {
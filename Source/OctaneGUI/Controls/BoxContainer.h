@@ -78,6 +78,7 @@ private:
     Orientation m_Orient { Orientation::Horizontal };
     Vector2 m_Spacing { 4.0f, 4.0f };
     bool m_IgnoreDesiredSize { false };
+    mutable std::vector<Vector2> m_DesiredSizes {};
 };
 
 }
@@ -28,6 +28,7 @@ SOFTWARE.
 #include "../Json.h"
 #include "../Paint.h"
 #include "../Profiler.h"
+#include "../Theme.h"
 #include "CheckBox.h"
 #include "ComboBox.h"
 #include "ControlList.h"
@@ -63,6 +64,7 @@ namespace OctaneGUI
 Container::Container(Window* InWindow)
     : Control(InWindow)
 {
+    SetIsContainer(true);
     SetForwardKeyEvents(true);
 }
 
@@ -201,6 +203,7 @@ Container* Container::InsertControl(const std::shared_ptr<Control>& Item, int Po
         m_Controls.push_back(Item);
     }
 
+    InvalidateDesiredSize();
     Invalidate(Item, InvalidateType::Paint);
     Invalidate(InvalidateType::Layout);
     OnInsertControl(Item);
@@ -214,6 +217,7 @@ Container* Container::RemoveControl(const std::shared_ptr<Control>& Item)
     if (Iter != m_Controls.end())
     {
         m_Controls.erase(Iter);
+        InvalidateDesiredSize();
         Invalidate(InvalidateType::Both);
         OnRemoveControl(Item);
     }
@@ -237,6 +241,7 @@ bool Container::HasControlRecurse(const std::shared_ptr<Control>& Item) const
 void Container::ClearControls()
 {
     m_Controls.clear();
+    InvalidateDesiredSize();
     Invalidate(InvalidateType::Both);
 }
 
@@ -262,20 +267,35 @@ bool Container::ShouldClip() const
     return m_Clip;
 }
 
+Container& Container::SetCachePaint(bool CachePaint)
+{
+    m_CachePaint = CachePaint;
+    m_PaintCache = PaintCache();
+    return *this;
+}
+
+bool Container::ShouldCachePaint() const
+{
+    return m_CachePaint;
+}
+
 Container* Container::Layout()
 {
-    PROFILER_SAMPLE_GROUP((std::string(GetType()) + "::Layout").c_str());
+    PROFILER_SAMPLE_GROUP_KEY("", GetType(), "::Layout");
 
     m_InLayout = true;
+    m_PaintCache.Dirty = true;
 
     {
         PROFILER_SAMPLE("PlaceControls");
+        m_PlacingControls = true;
         PlaceControls(m_Controls);
+        m_PlacingControls = false;
     }
 
     for (const std::shared_ptr<Control>& Item : m_Controls)
     {
-        const std::shared_ptr<Container> Child = std::dynamic_pointer_cast<Container>(Item);
+        Container* Child = Container::Cast(Item.get());
         if (Child)
         {
             Child->Layout();
@@ -310,7 +330,7 @@ std::weak_ptr<Control> Container::GetControl(const Vector2& Point) const
     {
         const std::shared_ptr<Control>& Item = m_Controls[I];
 
-        const std::shared_ptr<Container> ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Container::Cast(Item.get());
         if (ItemContainer)
         {
             Result = ItemContainer->GetControl(Point);
@@ -335,7 +355,7 @@ void Container::GetControls(std::vector<std::shared_ptr<Control>>& Controls) con
     {
         Controls.push_back(Item);
 
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Container::Cast(Item.get());
         if (ItemContainer)
         {
             ItemContainer->GetControls(Controls);
@@ -343,6 +363,16 @@ void Container::GetControls(std::vector<std::shared_ptr<Control>>& Controls) con
     }
 }
 
+Container* Container::Cast(Control* Item)
+{
+    return Item != nullptr && Item->IsContainer() ? static_cast<Container*>(Item) : nullptr;
+}
+
+const Container* Container::Cast(const Control* Item)
+{
+    return Item != nullptr && Item->IsContainer() ? static_cast<const Container*>(Item) : nullptr;
+}
+
 Vector2 Container::ChildrenSize() const
 {
     Vector2 Result;
@@ -351,7 +381,7 @@ Vector2 Container::ChildrenSize() const
     {
         Vector2 Size = Item->GetSize();
 
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Container::Cast(Item.get());
         if (ItemContainer)
         {
             Size = ItemContainer->DesiredSize();
@@ -370,7 +400,7 @@ void Container::GetControlList(ControlList& List) const
 
     for (const std::shared_ptr<Control>& Item : Controls())
     {
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Container::Cast(Item.get());
         if (ItemContainer)
         {
             ItemContainer->GetControlList(List);
@@ -400,25 +430,45 @@ void Container::SetWindow(Window* InWindow)
 
 void Container::OnPaint(Paint& Brush) const
 {
-    PROFILER_SAMPLE_GROUP((std::string(GetType()) + "::OnPaint").c_str());
+    PROFILER_SAMPLE_GROUP_KEY("", GetType(), "::OnPaint");
 
-    if (ShouldClip())
+    if (!m_CachePaint)
     {
-        Brush.PushClip(GetAbsoluteBounds());
+        PaintControls(Brush);
+        return;
     }
 
-    for (const std::shared_ptr<Control>& Item : m_Controls)
+    const Rect Bounds = GetAbsoluteBounds();
+    const Rect Clip = Brush.CurrentClip();
+    const uint32_t ThemeGeneration = Brush.GetTheme()->Generation();
+    if (!m_PaintCache.Dirty && m_PaintCache.Bounds == Bounds && m_PaintCache.Clip == Clip && m_PaintCache.ThemeGeneration == ThemeGeneration && Brush.UseFonts(m_PaintCache.Fonts))
     {
-        if (!Brush.IsClipped(Item->GetAbsoluteBounds()))
-        {
-            Item->OnPaint(Brush);
-        }
+        Brush.Replay(m_PaintCache.Buffer);
+        return;
     }
 
-    if (ShouldClip())
-    {
-        Brush.PopClip();
-    }
+    const VertexBuffer& Buffer = Brush.GetBuffer();
+    const uint32_t VertexStart = Buffer.GetVertexCount();
+    const uint32_t IndexStart = Buffer.GetIndexCount();
+    const uint32_t CommandStart = (uint32_t)Buffer.Commands().size();
+
+    // The cache must hold everything this container paints, not just what overlaps the damaged regions.
+    // The first command is also kept separate from the previous one so it is captured as a whole.
+    // The fonts are recorded since their glyphs may be moved or replaced without invalidating this container.
+    m_PaintCache.Fonts.clear();
+    Brush.BreakBatch();
+    Brush.SuspendDamage(true);
+    std::vector<Paint::FontRecord>* Fonts = Brush.BeginRecordFonts(m_PaintCache.Fonts);
+    PaintControls(Brush);
+    Brush.EndRecordFonts(Fonts);
+    Brush.SuspendDamage(false);
+
+    m_PaintCache.Buffer.Clear();
+    m_PaintCache.Buffer.Append(Buffer, VertexStart, IndexStart, CommandStart);
+    m_PaintCache.Bounds = Bounds;
+    m_PaintCache.Clip = Clip;
+    m_PaintCache.ThemeGeneration = ThemeGeneration;
+    m_PaintCache.Dirty = false;
 }
 
 void Container::OnLoad(const Json& Root)
@@ -440,6 +490,7 @@ void Container::OnLoad(const Json& Root)
     }
 
     SetClip(Root["Clip"].Boolean(ShouldClip()));
+    SetCachePaint(Root["CachePaint"].Boolean(ShouldCachePaint()));
 }
 
 void Container::OnSave(Json& Root) const
@@ -477,7 +528,7 @@ bool Container::IsInLayout() const
         return true;
     }
 
-    Container const* Parent = dynamic_cast<Container const*>(GetParent());
+    const Container* Parent = Container::Cast(GetParent());
     if (Parent != nullptr)
     {
         return Parent->IsInLayout();
@@ -488,6 +539,32 @@ bool Container::IsInLayout() const
 
 void Container::HandleInvalidate(std::shared_ptr<Control> Focus, InvalidateType Type)
 {
+    // Any invalidation within this hierarchy means the cached paint commands are stale. A container
+    // invalidating itself only notifies its parent, so its own cache is marked here as well.
+    m_PaintCache.Dirty = true;
+    Container* FocusContainer = Container::Cast(Focus.get());
+    if (FocusContainer != nullptr)
+    {
+        FocusContainer->m_PaintCache.Dirty = true;
+    }
+
+    // Layout changes are not propagated while a parent is being laid out, so the desired size of
+    // every ancestor is marked stale here instead of relying on the invalidation to reach them.
+    // Children moved or resized while this container places them are skipped, since the desired
+    // size only depends on their contents and would otherwise be recomputed on every layout.
+    const bool Placed = m_PlacingControls && Focus && Focus->GetParent() == this;
+    if (Type != InvalidateType::Paint && !Placed)
+    {
+        if (FocusContainer != nullptr)
+        {
+            FocusContainer->InvalidateDesiredSize();
+        }
+        else
+        {
+            InvalidateDesiredSize();
+        }
+    }
+
     if (IsInLayout() && Type != InvalidateType::Paint)
     {
         return;
@@ -496,12 +573,39 @@ void Container::HandleInvalidate(std::shared_ptr<Control> Focus, InvalidateType
     Invalidate(Focus, Type);
 }
 
+void Container::InvalidateDesiredSize()
+{
+    Container* Item = this;
+    while (Item != nullptr)
+    {
+        Item->m_DesiredSizeCache.Valid = false;
+        Item = Container::Cast(Item->GetParent());
+    }
+}
+
+bool Container::IsDesiredSizeCached() const
+{
+    return m_DesiredSizeCache.Valid;
+}
+
+Vector2 Container::CachedDesiredSize() const
+{
+    return m_DesiredSizeCache.Size;
+}
+
+Vector2 Container::CacheDesiredSize(const Vector2& Size) const
+{
+    m_DesiredSizeCache.Size = Size;
+    m_DesiredSizeCache.Valid = true;
+    return Size;
+}
+
 void Container::PlaceControls(const std::vector<std::shared_ptr<Control>>& Controls) const
 {
     for (const std::shared_ptr<Control>& Item : Controls)
     {
         Vector2 ItemSize = Item->GetSize();
-        const std::shared_ptr<Container> ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Container::Cast(Item.get());
         if (ItemContainer)
         {
             ItemSize = ItemContainer->DesiredSize();
@@ -533,4 +637,26 @@ void Container::OnLayoutComplete()
 {
 }
 
+void Container::PaintControls(Paint& Brush) const
+{
+    if (ShouldClip())
+    {
+        Brush.PushClip(GetAbsoluteBounds());
+    }
+
+    for (const std::shared_ptr<Control>& Item : m_Controls)
+    {
+        const Rect Bounds = Item->GetAbsoluteBounds();
+        if (!Brush.IsClipped(Bounds) && Brush.IsDamaged(Bounds))
+        {
+            Item->OnPaint(Brush);
+        }
+    }
+
+    if (ShouldClip())
+    {
+        Brush.PopClip();
+    }
+}
+
 }
@@ -26,6 +26,7 @@ SOFTWARE.
 
 #pragma once
 
+#include "../Paint.h"
 #include "../VertexBuffer.h"
 #include "Control.h"
 
@@ -72,6 +73,18 @@ public:
     Container& SetClip(bool Clip);
     bool ShouldClip() const;
 
+    /// @brief Caches the paint commands of this container's children between repaints.
+    ///
+    /// When enabled, the vertices, indices, and draw commands emitted by the children are
+    /// kept after painting. If nothing within this container has been invalidated and it
+    /// has not moved, the next repaint copies the cached commands instead of painting
+    /// each child again.
+    ///
+    /// @param CachePaint Whether to cache paint commands.
+    /// @return This Container reference.
+    Container& SetCachePaint(bool CachePaint);
+    bool ShouldCachePaint() const;
+
     Container* Layout();
     void InvalidateLayout();
 
@@ -94,6 +107,12 @@ public:
     void GetControls(std::vector<std::shared_ptr<Control>>& Controls) const;
     const std::vector<std::shared_ptr<Control>>& Controls() const;
     Vector2 ChildrenSize() const;
+
+    /// @brief Casts the given control to a Container using the IsContainer flag instead of RTTI.
+    /// @param Item The control to cast. Can be NULL.
+    /// @return The Container or NULL if the control is not a Container.
+    static Container* Cast(Control* Item);
+    static const Container* Cast(const Control* Item);
     virtual void GetControlList(ControlList& List) const;
     virtual Vector2 DesiredSize() const;
     virtual void SetWindow(Window* InWindow) override;
@@ -107,15 +126,51 @@ protected:
     bool IsInLayout() const;
     void HandleInvalidate(std::shared_ptr<Control> Focus, InvalidateType Type);
 
+    /// @brief Marks the memoized desired size of this container and all of its ancestors as stale.
+    ///
+    /// This is called automatically when a descendant's layout is invalidated or the child list
+    /// changes. Subclasses should call this when a property that affects their desired size changes.
+    void InvalidateDesiredSize();
+
+    /// @brief Containers whose desired size only depends on their children and own properties can
+    /// use these to skip recomputing it until InvalidateDesiredSize is called.
+    bool IsDesiredSizeCached() const;
+    Vector2 CachedDesiredSize() const;
+    Vector2 CacheDesiredSize(const Vector2& Size) const;
+
     virtual void PlaceControls(const std::vector<std::shared_ptr<Control>>& Controls) const;
     virtual void OnInsertControl(const std::shared_ptr<Control>& Item);
     virtual void OnRemoveControl(const std::shared_ptr<Control>& Item);
     virtual void OnLayoutComplete();
 
 private:
+    struct PaintCache
+    {
+    public:
+        VertexBuffer Buffer {};
+        Rect Bounds {};
+        Rect Clip {};
+        std::vector<Paint::FontRecord> Fonts {};
+        uint32_t ThemeGeneration { 0 };
+        bool Dirty { true };
+    };
+
+    struct DesiredSizeCache
+    {
+    public:
+        Vector2 Size {};
+        bool Valid { false };
+    };
+
+    void PaintControls(Paint& Brush) const;
+
     std::vector<std::shared_ptr<Control>> m_Controls;
     bool m_InLayout { false };
+    bool m_PlacingControls { false };
     bool m_Clip { false };
+    bool m_CachePaint { false };
+    mutable PaintCache m_PaintCache {};
+    mutable DesiredSizeCache m_DesiredSizeCache {};
 };
 
 }
@@ -137,7 +137,12 @@ Control& Control::SetExpand(Expand InExpand)
         return *this;
     }
 
-    m_Expand = InExpand;
+    if (m_Expand != InExpand)
+    {
+        m_Expand = InExpand;
+        Invalidate(InvalidateType::Layout);
+    }
+
     return *this;
 }
 
@@ -294,6 +299,11 @@ Control& Control::ClearProperty(ThemeProperties::Property Property)
     return *this;
 }
 
+bool Control::IsContainer() const
+{
+    return m_IsContainer;
+}
+
 std::shared_ptr<Control> Control::Share()
 {
     return shared_from_this();
@@ -417,6 +427,12 @@ bool Control::IsFixedSize() const
     return false;
 }
 
+Control& Control::SetIsContainer(bool IsContainer)
+{
+    m_IsContainer = IsContainer;
+    return *this;
+}
+
 Control::Control()
 {
 }
@@ -308,6 +308,14 @@ public:
     /// @return This Control reference.
     Control& ClearProperty(ThemeProperties::Property Property);
 
+    /// @brief Whether this control is a Container.
+    ///
+    /// This is a flag set by the Container class so that hot paths such as layout
+    /// can identify containers without a dynamic cast.
+    ///
+    /// @return True if this control derives from Container.
+    bool IsContainer() const;
+
     std::shared_ptr<Control> Share();
     std::shared_ptr<Control const> Share() const;
 
@@ -346,6 +354,8 @@ protected:
 
     virtual bool IsFixedSize() const;
 
+    Control& SetIsContainer(bool IsContainer);
+
 private:
     Control();
 
@@ -358,6 +368,7 @@ private:
     ThemeProperties m_ThemeProperties {};
 
     bool m_ForwardKeyEvents { false };
+    bool m_IsContainer { false };
 };
 
 }
@@ -107,12 +107,7 @@ void Image::OnPaint(Paint& Brush) const
 
     PROFILER_SAMPLE_GROUP("Image::OnPaint");
 
-    const Vector2 Size = m_Texture->GetSize();
-    const Rect TexCoords(
-        m_UVs.Min / Size,
-        m_UVs.Max / Size);
-
-    Brush.Image(GetAbsoluteBounds(), TexCoords, m_Texture, m_Tint);
+    Brush.Image(GetAbsoluteBounds(), m_Texture->Normalize(m_UVs), m_Texture, m_Tint);
 }
 
 void Image::OnLoad(const Json& Root)
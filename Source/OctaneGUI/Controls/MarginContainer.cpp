@@ -38,6 +38,7 @@ MarginContainer::MarginContainer(Window* InWindow)
 MarginContainer& MarginContainer::SetMargins(const Rect& Margins)
 {
     m_Margins = Margins;
+    InvalidateDesiredSize();
     return *this;
 }
 
@@ -48,12 +49,17 @@ Rect MarginContainer::Margins() const
 
 Vector2 MarginContainer::DesiredSize() const
 {
+    if (IsDesiredSizeCached())
+    {
+        return CachedDesiredSize();
+    }
+
     Vector2 Result;
 
     for (const std::shared_ptr<Control>& Item : Controls())
     {
         Vector2 Size = Item->GetSize();
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Container::Cast(Item.get());
         if (ItemContainer)
         {
             Size = ItemContainer->DesiredSize();
@@ -63,7 +69,7 @@ Vector2 MarginContainer::DesiredSize() const
         Result.Y = std::max<float>(Result.Y, Size.Y);
     }
 
-    return Result + m_Margins.Min + m_Margins.Max;
+    return CacheDesiredSize(Result + m_Margins.Min + m_Margins.Max);
 }
 
 void MarginContainer::OnLoad(const Json& Root)
@@ -71,6 +77,7 @@ void MarginContainer::OnLoad(const Json& Root)
     Container::OnLoad(Root);
 
     m_Margins = Rect::FromJson(Root["Margins"]);
+    InvalidateDesiredSize();
 }
 
 void MarginContainer::OnSave(Json& Root) const
@@ -86,7 +93,7 @@ void MarginContainer::PlaceControls(const std::vector<std::shared_ptr<Control>>&
     {
         Vector2 Size = Item->GetSize();
 
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Container::Cast(Item.get());
         if (ItemContainer)
         {
             Size = ItemContainer->DesiredSize();
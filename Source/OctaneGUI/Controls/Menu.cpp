@@ -152,7 +152,7 @@ void Menu::Resize()
     {
         Vector2 ItemSize = Item->GetSize();
 
-        const std::shared_ptr<Container>& ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+        Container* ItemContainer = Container::Cast(Item.get());
         if (ItemContainer)
         {
             ItemSize = ItemContainer->DesiredSize();
@@ -363,7 +363,7 @@ Vector2 ScrollableContainer::GetContentSize(const std::vector<std::shared_ptr<Co
         if (Item != m_HorizontalSB && Item != m_VerticalSB && !m_HorizontalSB->HasControl(Item) && !m_VerticalSB->HasControl(Item))
         {
             Vector2 Size = Item->GetSize();
-            const std::shared_ptr<Container> ItemContainer = std::dynamic_pointer_cast<Container>(Item);
+            Container* ItemContainer = Container::Cast(Item.get());
             if (ItemContainer)
             {
                 Size = ItemContainer->DesiredSize();
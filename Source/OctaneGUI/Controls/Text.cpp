@@ -32,6 +32,7 @@ SOFTWARE.
 #include "../String.h"
 #include "../Theme.h"
 
+#include <algorithm>
 #include <cassert>
 
 namespace OctaneGUI
@@ -55,6 +56,84 @@ Text& Text::SetText(const char* InContents)
 Text& Text::SetText(const char32_t* InContents)
 {
     m_Contents = InContents;
+    m_ContentVersion++;
+    m_LineSizesValid = false;
+    IndexLines();
+    UpdateSize();
+    return *this;
+}
+
+Text& Text::Insert(uint32_t Index, const std::u32string_view& Contents)
+{
+    Index = std::min<uint32_t>(Index, (uint32_t)m_Contents.length());
+    const uint32_t Line = LineOf(Index);
+    const uint32_t Length = (uint32_t)Contents.length();
+
+    m_Contents.insert(Index, Contents.data(), Contents.length());
+    m_ContentVersion++;
+
+    // Lines after the insertion point are shifted and any inserted newlines start new lines.
+    for (size_t I = Line + 1; I < m_LineStarts.size(); I++)
+    {
+        m_LineStarts[I] += Length;
+    }
+
+    std::vector<uint32_t> Starts;
+    for (uint32_t I = 0; I < Length; I++)
+    {
+        if (Contents[I] == U'\n')
+        {
+            Starts.push_back(Index + I + 1);
+        }
+    }
+
+    const uint32_t NewLines = (uint32_t)Starts.size();
+    m_LineStarts.insert(m_LineStarts.begin() + Line + 1, Starts.begin(), Starts.end());
+
+    if (m_LineSizesValid && !m_Wrap)
+    {
+        // The line the characters were inserted into is split by any inserted newlines.
+        ReplaceLines(Line, 1, m_LineStarts[Line], NewLines + 1);
+    }
+    else
+    {
+        m_LineSizesValid = false;
+    }
+
+    UpdateSize();
+    return *this;
+}
+
+Text& Text::Erase(uint32_t Index, uint32_t Count)
+{
+    if (Index >= m_Contents.length() || Count == 0)
+    {
+        return *this;
+    }
+
+    Count = std::min<uint32_t>(Count, (uint32_t)m_Contents.length() - Index);
+    const uint32_t Line = LineOf(Index);
+    // Lines starting after a removed newline are joined into the line the range started on.
+    const uint32_t Removed = LineOf(Index + Count) - Line;
+
+    m_Contents.erase(Index, Count);
+    m_ContentVersion++;
+
+    m_LineStarts.erase(m_LineStarts.begin() + Line + 1, m_LineStarts.begin() + Line + 1 + Removed);
+    for (size_t I = Line + 1; I < m_LineStarts.size(); I++)
+    {
+        m_LineStarts[I] -= Count;
+    }
+
+    if (m_LineSizesValid && !m_Wrap)
+    {
+        ReplaceLines(Line, Removed + 1, m_LineStarts[Line], 1);
+    }
+    else
+    {
+        m_LineSizesValid = false;
+    }
+
     UpdateSize();
     return *this;
 }
@@ -74,6 +153,27 @@ uint32_t Text::Length() const
     return m_Contents.length();
 }
 
+uint32_t Text::LineCount() const
+{
+    return (uint32_t)m_LineStarts.size();
+}
+
+uint32_t Text::LineStart(uint32_t Line) const
+{
+    return m_LineStarts[std::min<size_t>(Line, m_LineStarts.size() - 1)];
+}
+
+uint32_t Text::LineEnd(uint32_t Line) const
+{
+    // The next line starts right after the newline that ends this one.
+    return Line + 1 < m_LineStarts.size() ? m_LineStarts[Line + 1] - 1 : (uint32_t)m_Contents.length();
+}
+
+uint32_t Text::LineOf(uint32_t Index) const
+{
+    return (uint32_t)(std::upper_bound(m_LineStarts.begin(), m_LineStarts.end(), Index) - m_LineStarts.begin()) - 1;
+}
+
 const std::shared_ptr<Font>& Text::GetFont() const
 {
     return m_Font;
@@ -111,6 +211,7 @@ Text& Text::SetFontSize(float Size)
 Text& Text::SetWrap(bool Wrap)
 {
     m_Wrap = Wrap;
+    m_LineSizesValid = false;
     return *this;
 }
 
@@ -145,28 +246,28 @@ void Text::OnPaint(Paint& Brush) const
 
     const Vector2 Position = GetAbsolutePosition();
 
-    if (m_Spans.size() > 0)
+    if (m_Wrap)
     {
-        if (m_Wrap)
+        // Nothing is laid out again unless the contents, font or width changed since the last measure.
+        m_Layout.Update(m_Font, m_Contents, m_ContentVersion, m_WrapWidth > 0.0f ? m_WrapWidth : GetSize().X);
+
+        if (m_Spans.size() > 0)
         {
-            Brush.TextWrapped(m_Font, Position.Floor(), m_Contents, m_Spans, GetSize().X);
+            Brush.Text(m_Layout, Position.Floor(), m_Spans);
         }
         else
         {
-            Brush.Textf(m_Font, Position.Floor(), m_Contents, m_Spans);
+            Brush.Text(m_Layout, Position.Floor(), { { 0, m_Contents.size(), GetProperty(ThemeProperties::Text).ToColor() } });
         }
     }
+    else if (m_Spans.size() > 0)
+    {
+        Brush.Textf(m_Font, Position.Floor(), m_Contents, m_Spans);
+    }
     else
     {
         Color TextColor = GetProperty(ThemeProperties::Text).ToColor();
-        if (m_Wrap)
-        {
-            Brush.TextWrapped(m_Font, Position.Floor(), m_Contents, { { 0, m_Contents.size(), TextColor } }, GetSize().X);
-        }
-        else
-        {
-            Brush.Text(m_Font, Position.Floor(), m_Contents, TextColor);
-        }
+        Brush.Text(m_Font, Position.Floor(), m_Contents, TextColor);
     }
 }
 
@@ -211,6 +312,7 @@ void Text::UpdateFont()
     const char* FontPath = GetProperty(ThemeProperties::FontPath).String(nullptr);
     const float FontSize = GetProperty(ThemeProperties::FontSize).Float(LineHeight()) * RenderScale().Y;
     m_Font = GetTheme()->GetOrAddFont(FontPath, FontSize);
+    m_LineSizesValid = false;
 }
 
 void Text::UpdateSize()
@@ -220,16 +322,126 @@ void Text::UpdateSize()
         int Lines = 0;
         if (m_Wrap && GetParent() != nullptr)
         {
-            const float Width = GetParent()->GetSize().X;
-            m_ContentSize = m_Font->Measure(m_Contents, Lines, Width);
+            m_WrapWidth = GetParent()->GetSize().X;
+            m_Layout.Update(m_Font, m_Contents, m_ContentVersion, m_WrapWidth);
+            m_ContentSize = m_Layout.Size();
+            Lines = (int)m_Layout.LineCount();
         }
         else
         {
-            m_ContentSize = m_Font->Measure(m_Contents, Lines);
+            if (!m_LineSizesValid)
+            {
+                MeasureLines();
+            }
+
+            Lines = (int)m_LineSizes.size();
         }
 
         SetSize({ m_ContentSize.X, m_Font->Size() * Lines });
     }
 }
 
+void Text::MeasureLines()
+{
+    m_LineSizes.clear();
+    m_ContentSize = {};
+
+    uint32_t Start = 0;
+    while (true)
+    {
+        uint32_t End = 0;
+        const Vector2 Size = MeasureLine(Start, End);
+        m_LineSizes.push_back(Size);
+        m_ContentSize.X = std::max<float>(m_ContentSize.X, Size.X);
+        m_ContentSize.Y += Size.Y;
+
+        if (End >= m_Contents.length())
+        {
+            break;
+        }
+
+        Start = End + 1;
+    }
+
+    m_LineSizesValid = true;
+}
+
+Vector2 Text::MeasureLine(uint32_t Start, uint32_t& End) const
+{
+    Vector2 Result;
+
+    // Font::Measure includes the newline character in the size of the line that follows it.
+    if (Start > 0)
+    {
+        const Vector2 Size = m_Font->Measure(m_Contents[Start - 1]);
+        Result.X += Size.X;
+        Result.Y = std::max<float>(Result.Y, Size.Y);
+    }
+
+    End = Start;
+    for (; End < m_Contents.length() && m_Contents[End] != U'\n'; End++)
+    {
+        const Vector2 Size = m_Font->Measure((uint32_t)m_Contents[End]);
+        Result.X += Size.X;
+        Result.Y = std::max<float>(Result.Y, Size.Y);
+    }
+
+    return Result;
+}
+
+void Text::ReplaceLines(uint32_t Line, uint32_t Count, uint32_t Start, uint32_t NewCount)
+{
+    bool Rescan = false;
+    for (uint32_t I = Line; I < Line + Count; I++)
+    {
+        const Vector2& Size = m_LineSizes[I];
+        m_ContentSize.Y -= Size.Y;
+        Rescan |= Size.X >= m_ContentSize.X;
+    }
+
+    m_LineSizes.erase(m_LineSizes.begin() + Line, m_LineSizes.begin() + Line + Count);
+    m_LineSizes.insert(m_LineSizes.begin() + Line, NewCount, Vector2());
+
+    for (uint32_t I = Line; I < Line + NewCount; I++)
+    {
+        uint32_t End = 0;
+        const Vector2 Size = MeasureLine(Start, End);
+        m_LineSizes[I] = Size;
+        m_ContentSize.Y += Size.Y;
+        Start = End + 1;
+    }
+
+    // The widest line may have been one of the replaced lines, in which case the width has to be
+    // found again. Otherwise only the new lines can make the contents wider.
+    if (Rescan)
+    {
+        m_ContentSize.X = 0.0f;
+        for (const Vector2& Size : m_LineSizes)
+        {
+            m_ContentSize.X = std::max<float>(m_ContentSize.X, Size.X);
+        }
+    }
+    else
+    {
+        for (uint32_t I = Line; I < Line + NewCount; I++)
+        {
+            m_ContentSize.X = std::max<float>(m_ContentSize.X, m_LineSizes[I].X);
+        }
+    }
+}
+
+void Text::IndexLines()
+{
+    m_LineStarts.clear();
+    m_LineStarts.push_back(0);
+
+    for (size_t I = 0; I < m_Contents.length(); I++)
+    {
+        if (m_Contents[I] == U'\n')
+        {
+            m_LineStarts.push_back((uint32_t)I + 1);
+        }
+    }
+}
+
 }
@@ -26,6 +26,7 @@ SOFTWARE.
 
 #pragma once
 
+#include "../TextLayout.h"
 #include "../TextSpan.h"
 #include "Control.h"
 
@@ -53,9 +54,57 @@ public:
 
     Text& SetText(const char* InContents);
     Text& SetText(const char32_t* InContents);
+
+    /// @brief Inserts characters into the contents without copying the whole string.
+    ///
+    /// Only the lines touched by the insertion are measured again.
+    ///
+    /// @param Index Position in the contents to insert at.
+    /// @param Contents Characters to insert.
+    /// @return This Text reference.
+    Text& Insert(uint32_t Index, const std::u32string_view& Contents);
+
+    /// @brief Removes a range of characters from the contents.
+    ///
+    /// Only the line containing the removed range is measured again.
+    ///
+    /// @param Index Position of the first character to remove.
+    /// @param Count Number of characters to remove.
+    /// @return This Text reference.
+    Text& Erase(uint32_t Index, uint32_t Count);
+
     const char32_t* GetText() const;
     const std::u32string& GetString() const;
     uint32_t Length() const;
+
+    /// @brief Number of lines separated by newline characters.
+    ///
+    /// This count is not affected by wrapping.
+    ///
+    /// @return Number of lines. Always at least one.
+    uint32_t LineCount() const;
+
+    /// @brief Index of the first character on the given line.
+    ///
+    /// @param Line The line to look up. Clamped to the last line.
+    /// @return Index into the contents.
+    uint32_t LineStart(uint32_t Line) const;
+
+    /// @brief Index of the newline character that ends the given line.
+    ///
+    /// @param Line The line to look up. Clamped to the last line.
+    /// @return Index into the contents or the length for the last line.
+    uint32_t LineEnd(uint32_t Line) const;
+
+    /// @brief Finds the line that contains the given index.
+    ///
+    /// A newline character belongs to the line it ends. This is a
+    /// binary search over the line start index.
+    ///
+    /// @param Index Index into the contents.
+    /// @return The line number.
+    uint32_t LineOf(uint32_t Index) const;
+
     const std::shared_ptr<Font>& GetFont() const;
     float LineHeight() const;
 
@@ -81,12 +130,26 @@ protected:
 private:
     void UpdateFont();
     void UpdateSize();
+    void MeasureLines();
+    Vector2 MeasureLine(uint32_t Start, uint32_t& End) const;
+    void ReplaceLines(uint32_t Line, uint32_t Count, uint32_t Start, uint32_t NewCount);
+    void IndexLines();
 
     std::u32string m_Contents {};
+    // Incremented on every change to the contents so the wrapped layout knows when to be built again.
+    uint32_t m_ContentVersion { 0 };
+    // Index of the first character of each line, kept sorted and updated on edits.
+    std::vector<uint32_t> m_LineStarts { 0 };
     Vector2 m_ContentSize {};
+    // Size of each line when not wrapping. Allows edits to only measure the lines that changed.
+    std::vector<Vector2> m_LineSizes {};
+    bool m_LineSizesValid { false };
     std::vector<TextSpan> m_Spans {};
     std::shared_ptr<Font> m_Font { nullptr };
     bool m_Wrap { false };
+    // Wrapped text is laid out when it is measured and reused while painting until it changes.
+    mutable TextLayout m_Layout {};
+    float m_WrapWidth { 0.0f };
 };
 
 }
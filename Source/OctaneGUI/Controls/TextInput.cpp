@@ -1002,9 +1002,8 @@ void TextInput::AddText(const std::u32string& Contents)
     }
 
     const uint32_t Length = (uint32_t)Stripped.length();
-    std::u32string Current = m_Text->GetText();
-    Current.insert(Current.begin() + m_Position.Index(), Stripped.begin(), Stripped.end());
-    InternalSetText(Current.c_str());
+    m_Text->Insert(m_Position.Index(), Stripped);
+    TextChanged();
     Scrollable()->Update();
 
     // Need to update the last visible line index as it has changed to the length of the string changing.
@@ -1047,12 +1046,9 @@ void TextInput::Delete(int32_t Range)
     int32_t Move = std::min<int32_t>(Range, 0);
     MovePosition(0, Move);
 
-    // TODO: Maybe allow altering the contents in-place and repaint?
-    std::u32string Contents = m_Text->GetText();
-    TextDeleted({ &Contents[Min], (size_t)(Max - Min) });
-    Contents.erase(Contents.begin() + (uint32_t)Min, Contents.begin() + (uint32_t)Max);
-
-    InternalSetText(Contents.c_str());
+    TextDeleted({ &GetString()[Min], (size_t)(Max - Min) });
+    m_Text->Erase((uint32_t)Min, (uint32_t)(Max - Min));
+    TextChanged();
     Scrollable()->Update();
 
     // Force update the visible lines
@@ -1106,35 +1102,27 @@ TextInput::TextPosition TextInput::GetPosition(const Vector2& Position) const
     // The text control is offset by a margin container so this needs to be taken into account.
     const Vector2 TextOffset { MARGIN, MARGIN };
 
-    // Find the starting index based on what line the position is on.
-    size_t StartIndex = m_FirstVisibleLine.IsValid() ? m_FirstVisibleLine.Index() : 0;
+    // Find the line the position is on. Lines above the first visible line are not considered.
+    const float Y = (LocalPosition.Y + TextOffset.Y) / LineHeight;
+    const uint32_t FirstLine = m_FirstVisibleLine.IsValid() ? m_FirstVisibleLine.Line() : 0;
+    const uint32_t LineCount = m_Text->LineCount();
+    uint32_t Line = Y > 0.0f ? (uint32_t)std::min<float>(Y, (float)LineCount) : 0;
+    Line = std::max<uint32_t>(Line, FirstLine);
+
     size_t Index = 0;
-    uint32_t Line = m_FirstVisibleLine.IsValid() ? m_FirstVisibleLine.Line() : 0;
     uint32_t Column = 0;
-    Vector2 Offset = { 0.0f, LineHeight * (Line > 0 ? Line + 1 : 1) };
-    while (StartIndex != std::string::npos)
+    Vector2 Offset;
+    if (Line < LineCount)
     {
-        if (Offset.Y > LocalPosition.Y + TextOffset.Y)
-        {
-            Index = StartIndex;
-            break;
-        }
-
-        size_t Find = String.find('\n', StartIndex);
-        if (Find != std::string::npos)
-        {
-            Line++;
-            StartIndex = Find + 1;
-            Offset.Y += LineHeight;
-        }
-        else
-        {
-            // Reached the end of the string. Mark the column to be the end
-            // of the final line and make the index be the size of the string.
-            Column = String.size() - StartIndex;
-            Index = String.size();
-            break;
-        }
+        Index = m_Text->LineStart(Line);
+    }
+    else
+    {
+        // Reached the end of the string. Mark the column to be the end
+        // of the final line and make the index be the size of the string.
+        Line = LineCount - 1;
+        Index = String.size();
+        Column = String.size() - m_Text->LineStart(Line);
     }
 
     // Find the character on the line that is after the given position.
@@ -1194,39 +1182,21 @@ int32_t TextInput::GetRangeOr(int32_t Value) const
 
 uint32_t TextInput::LineStartIndex(uint32_t Index) const
 {
-    const std::u32string& String = m_Text->GetString();
-
-    // The index may already be on a newline character. Start the search at the character
-    // before this one.
-    const uint32_t Offset = String[Index] == '\n' ? std::max<int>(Index - 1, 0) : Index;
-    size_t Result = String.rfind('\n', Offset);
-    return Result == std::string::npos ? 0 : Result;
+    // Returns the newline character that precedes the line containing the index. A newline
+    // character at the index belongs to the line it ends.
+    const uint32_t Line = m_Text->LineOf(Index);
+    return Line == 0 ? 0 : m_Text->LineStart(Line) - 1;
 }
 
 uint32_t TextInput::LineEndIndex(uint32_t Index) const
 {
-    const std::u32string& String = m_Text->GetString();
-
-    if (String[Index] == '\n')
-    {
-        return Index;
-    }
-
-    size_t Result = String.find('\n', Index);
-    return Result == std::string::npos ? String.size() : Result;
+    return m_Text->LineEnd(m_Text->LineOf(Index));
 }
 
 uint32_t TextInput::LineSize(uint32_t Index) const
 {
-    const std::u32string& String = m_Text->GetString();
-    uint32_t Start = LineStartIndex(Index);
-    // The line should start at the character after the newline character.
-    if (String[Start] == '\n')
-    {
-        Start++;
-    }
-    uint32_t End = LineEndIndex(Index);
-    return std::max<int>((int)End - (int)Start, 0);
+    const uint32_t Line = m_Text->LineOf(Index);
+    return m_Text->LineEnd(Line) - m_Text->LineStart(Line);
 }
 
 void TextInput::ScrollIntoView()
@@ -1320,6 +1290,11 @@ void TextInput::UpdateSpans()
 void TextInput::InternalSetText(const char32_t* InText)
 {
     m_Text->SetText(InText);
+    TextChanged();
+}
+
+void TextInput::TextChanged()
+{
     Invalidate();
 
     if (m_OnTextChanged)
@@ -1355,57 +1330,23 @@ void TextInput::UpdateVisibleLines()
         return;
     }
 
-    const std::u32string& String = m_Text->GetString();
-
-    size_t Start = 0;
-    size_t Index = 0;
-    uint32_t Count = 0;
-
-    // Find index of the first line.
-    while (Count < Line)
-    {
-        Index = String.find('\n', Start);
-
-        if (Index == std::string::npos)
-        {
-            break;
-        }
-
-        Index++;
-        Start = Index;
-        Count++;
-    }
-
-    Index = std::min<uint32_t>(Index, String.length());
-    m_FirstVisibleLine = { Line, 0, (uint32_t)Index };
-
-    // Find index of the last line.
-    while (Count < LastLine)
-    {
-        Index = String.find('\n', Start);
-
-        if (Index == std::string::npos)
-        {
-            break;
-        }
+    const uint32_t LineCount = m_Text->LineCount();
+    const uint32_t Length = m_Text->Length();
 
-        Index++;
-        Start = Index;
-        Count++;
-    }
+    // Lines past the end of the contents are clamped to the last line.
+    m_FirstVisibleLine = { Line, 0, Line < LineCount ? m_Text->LineStart(Line) : Length };
 
-    if (Index == std::string::npos)
+    uint32_t Index = Length;
+    if (LastLine < LineCount)
     {
-        Index = String.length();
-        LastLine = Count;
+        Index = m_Text->LineEnd(LastLine);
     }
     else
     {
-        Index = LineEndIndex(Index);
+        LastLine = LineCount - 1;
     }
 
-    Index = std::min<uint32_t>(Index, String.length());
-    m_LastVisibleLine = { LastLine, (uint32_t)Index - LineStartIndex(Index), (uint32_t)Index };
+    m_LastVisibleLine = { LastLine, Index - LineStartIndex(Index), Index };
 
     m_Text->SetPosition({ 0.0f, m_FirstVisibleLine.Line() * LineHeight });
 }
@@ -181,6 +181,7 @@ private:
     void ScrollIntoView();
     void UpdateSpans();
     void InternalSetText(const char32_t* InText);
+    void TextChanged();
     void ResetCursorTimer();
     void UpdateVisibleLines();
     void SetVisibleLineSpan();
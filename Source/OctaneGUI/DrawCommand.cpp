@@ -29,12 +29,13 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
-DrawCommand::DrawCommand(uint32_t VertexOffset, uint32_t IndexOffset, uint32_t IndexCount, uint32_t TextureID, Rect Clip)
+DrawCommand::DrawCommand(uint32_t VertexOffset, uint32_t IndexOffset, uint32_t IndexCount, uint32_t TextureID, Rect Clip, bool DistanceField)
     : m_VertexOffset(VertexOffset)
     , m_IndexOffset(IndexOffset)
     , m_IndexCount(IndexCount)
     , m_TextureID(TextureID)
     , m_Clip(Clip)
+    , m_DistanceField(DistanceField)
 {
 }
 
@@ -63,12 +64,18 @@ Rect DrawCommand::Clip() const
     return m_Clip;
 }
 
+bool DrawCommand::DistanceField() const
+{
+    return m_DistanceField;
+}
+
 DrawCommand::DrawCommand()
     : m_VertexOffset(0)
     , m_IndexOffset(0)
     , m_IndexCount(0)
     , m_TextureID(0)
     , m_Clip()
+    , m_DistanceField(false)
 {
 }
 
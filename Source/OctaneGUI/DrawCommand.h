@@ -36,7 +36,7 @@ namespace OctaneGUI
 class DrawCommand
 {
 public:
-    DrawCommand(uint32_t VertexOffset, uint32_t IndexOffset, uint32_t IndexCount, uint32_t TextureID, Rect Clip);
+    DrawCommand(uint32_t VertexOffset, uint32_t IndexOffset, uint32_t IndexCount, uint32_t TextureID, Rect Clip, bool DistanceField = false);
     ~DrawCommand();
 
     uint32_t VertexOffset() const;
@@ -45,6 +45,12 @@ public:
     uint32_t TextureID() const;
     Rect Clip() const;
 
+    /// @brief The texture holds signed distance fields, such as a distance field font atlas.
+    ///
+    /// The alpha of each texel is the distance to the nearest edge, where 0.5 is on the edge.
+    /// Renderers should convert this to coverage before blending.
+    bool DistanceField() const;
+
 private:
     DrawCommand();
 
@@ -53,6 +59,7 @@ private:
     uint32_t m_IndexCount;
     uint32_t m_TextureID;
     Rect m_Clip;
+    bool m_DistanceField;
 };
 
 }
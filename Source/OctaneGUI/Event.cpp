@@ -45,6 +45,9 @@ const char* ToString(Event::Type InType)
     case Event::Type::WindowEnter: return "WindowEnter";
     case Event::Type::WindowLeave: return "WindowLeave";
     case Event::Type::WindowMoved: return "WindowMoved";
+    case Event::Type::WindowMaximized: return "WindowMaximized";
+    case Event::Type::WindowGainedFocus: return "WindowGainedFocus";
+    case Event::Type::WindowLostFocus: return "WindowLostFocus";
     case Event::Type::None:
     default: break;
     }
@@ -0,0 +1,239 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "EventScript.h"
+#include "Json.h"
+#include "String.h"
+
+#include <cstring>
+
+namespace OctaneGUI
+{
+
+static const std::pair<const char*, Keyboard::Key> g_Keys[] = {
+    { "P", Keyboard::Key::P },
+    { "V", Keyboard::Key::V },
+    { "Escape", Keyboard::Key::Escape },
+    { "Backspace", Keyboard::Key::Backspace },
+    { "Delete", Keyboard::Key::Delete },
+    { "Left", Keyboard::Key::Left },
+    { "Right", Keyboard::Key::Right },
+    { "Up", Keyboard::Key::Up },
+    { "Down", Keyboard::Key::Down },
+    { "Home", Keyboard::Key::Home },
+    { "End", Keyboard::Key::End },
+    { "LeftShift", Keyboard::Key::LeftShift },
+    { "RightShift", Keyboard::Key::RightShift },
+    { "LeftControl", Keyboard::Key::LeftControl },
+    { "RightControl", Keyboard::Key::RightControl },
+    { "LeftAlt", Keyboard::Key::LeftAlt },
+    { "RightAlt", Keyboard::Key::RightAlt },
+    { "Enter", Keyboard::Key::Enter },
+    { "Tilde", Keyboard::Key::Tilde },
+    { "Tab", Keyboard::Key::Tab },
+};
+
+static Event::Type ToEventType(const char* Name)
+{
+    for (uint32_t I = 0; I <= (uint32_t)Event::Type::WindowLostFocus; I++)
+    {
+        const Event::Type Type = (Event::Type)I;
+        if (std::strcmp(Event(Type).Name(), Name) == 0)
+        {
+            return Type;
+        }
+    }
+
+    return Event::Type::None;
+}
+
+static Keyboard::Key ToKey(const char* Name)
+{
+    for (const std::pair<const char*, Keyboard::Key>& Item : g_Keys)
+    {
+        if (std::strcmp(Item.first, Name) == 0)
+        {
+            return Item.second;
+        }
+    }
+
+    return Keyboard::Key::None;
+}
+
+static Mouse::Button ToButton(const char* Name)
+{
+    if (std::strcmp(Name, "Middle") == 0)
+    {
+        return Mouse::Button::Middle;
+    }
+    else if (std::strcmp(Name, "Right") == 0)
+    {
+        return Mouse::Button::Right;
+    }
+
+    return Mouse::Button::Left;
+}
+
+static Mouse::Count ToCount(const char* Name)
+{
+    if (std::strcmp(Name, "Double") == 0)
+    {
+        return Mouse::Count::Double;
+    }
+    else if (std::strcmp(Name, "Triple") == 0)
+    {
+        return Mouse::Count::Triple;
+    }
+
+    return Mouse::Count::Single;
+}
+
+// Converts a single script item into the events it describes. Returns false if the type is unknown.
+static bool ParseEvent(const Json& Item, std::vector<Event>& Events)
+{
+    const Event::Type Type = ToEventType(Item["Type"].String());
+    const Vector2 Position = Vector2::FromJson(Item["Position"]);
+
+    switch (Type)
+    {
+    case Event::Type::KeyPressed:
+    case Event::Type::KeyReleased:
+    {
+        Events.push_back(Event(Type, Event::Key(ToKey(Item["Key"].String()))));
+    }
+    break;
+
+    case Event::Type::MouseMoved:
+    {
+        Events.push_back(Event(Event::MouseMove(Position.X, Position.Y)));
+    }
+    break;
+
+    case Event::Type::MousePressed:
+    case Event::Type::MouseReleased:
+    {
+        Events.push_back(Event(Type, Event::MouseButton(ToButton(Item["Button"].String()), Position.X, Position.Y, ToCount(Item["Count"].String()))));
+    }
+    break;
+
+    case Event::Type::MouseWheel:
+    {
+        const Vector2 Delta = Vector2::FromJson(Item["Delta"]);
+        Events.push_back(Event(Event::MouseWheel((int)Delta.X, (int)Delta.Y)));
+    }
+    break;
+
+    case Event::Type::Text:
+    {
+        for (char32_t Code : String::ToUTF32(Item["Text"].String()))
+        {
+            Events.push_back(Event(Event::Text((uint32_t)Code)));
+        }
+    }
+    break;
+
+    case Event::Type::WindowResized:
+    {
+        const Vector2 Size = Vector2::FromJson(Item["Size"]);
+        Events.push_back(Event(Event::WindowResized(Size.X, Size.Y)));
+    }
+    break;
+
+    case Event::Type::WindowMoved:
+    case Event::Type::WindowMaximized:
+    {
+        Events.push_back(Event(Type, Event::WindowMoved(Position)));
+    }
+    break;
+
+    case Event::Type::WindowClosed:
+    case Event::Type::WindowEnter:
+    case Event::Type::WindowLeave:
+    case Event::Type::WindowGainedFocus:
+    case Event::Type::WindowLostFocus:
+    {
+        Events.push_back(Event(Type));
+    }
+    break;
+
+    case Event::Type::None:
+    default: return false;
+    }
+
+    return true;
+}
+
+bool EventScript::Parse(const Json& Root, uint64_t& Frame, std::vector<Item>& Items)
+{
+    if (!Root["Events"].IsArray())
+    {
+        return false;
+    }
+
+    std::vector<Event> Events;
+    bool Result = true;
+
+    Root["Events"].ForEach([&](const Json& Value) -> void
+        {
+            const char* Type = Value["Type"].String();
+            if (std::strcmp(Type, "Wait") == 0)
+            {
+                Frame += (uint64_t)Value["Frames"].Number(1.0f);
+                return;
+            }
+
+            if (std::strcmp(Type, "Repeat") == 0)
+            {
+                const uint32_t Count = (uint32_t)Value["Count"].Number(1.0f);
+                for (uint32_t I = 0; I < Count; I++)
+                {
+                    Result = Parse(Value, Frame, Items) && Result;
+                }
+                return;
+            }
+
+            Events.clear();
+            if (!ParseEvent(Value, Events))
+            {
+                Result = false;
+                return;
+            }
+
+            const std::string Window = Value["Window"].String("Main");
+            for (const Event& Scheduled : Events)
+            {
+                Item Entry;
+                Entry.Frame = Frame;
+                Entry.Window = Window;
+                Entry.Value = Scheduled;
+                Items.push_back(Entry);
+            }
+        });
+
+    return Result;
+}
+
+}
@@ -0,0 +1,70 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "Event.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class Json;
+
+/// @brief Converts input scripts into events scheduled on the frame they should be dispatched.
+///
+/// A script is a JSON object with an 'Events' array. Each item has a 'Type' matching an event
+/// type name along with the fields for that type: 'Position' and 'Delta' are [X, Y] arrays,
+/// 'Button' is Left, Middle or Right, 'Count' is Single, Double or Triple, 'Key' is a key name,
+/// 'Size' is a [Width, Height] array and 'Text' becomes one event per character. Events target
+/// the 'Main' window unless a 'Window' ID is given. Consecutive items are scheduled on the same
+/// frame. An item of type 'Wait' delays the items after it by its number of 'Frames', which is
+/// 1 if not given. An item of type 'Repeat' plays its own 'Events' array 'Count' times.
+class EventScript
+{
+public:
+    struct Item
+    {
+    public:
+        uint64_t Frame { 0 };
+        std::string Window {};
+        Event Value { Event::Type::None };
+    };
+
+    /// @brief Appends the events of a script to a list.
+    ///
+    /// @param Root The parsed script.
+    /// @param Frame The frame the first items are scheduled on. Set to the frame of the last
+    /// item, including any trailing waits.
+    /// @param Items List the scheduled events are added to.
+    /// @return False if the script has no 'Events' array or an item has an unknown type.
+    static bool Parse(const Json& Root, uint64_t& Frame, std::vector<Item>& Items);
+};
+
+}
@@ -25,6 +25,7 @@ SOFTWARE.
 */
 
 #include "Font.h"
+#include "Defines.h"
 #include "Rect.h"
 #define STB_RECT_PACK_IMPLEMENTATION
 #include "External/stb/stb_rect_pack.h"
@@ -32,8 +33,25 @@ SOFTWARE.
 #include "External/stb/stb_truetype.h"
 #include "Texture.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <type_traits>
+
+#if defined(WINDOWS)
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
+
+#define DENSE_GLYPH_LIMIT 0x800
+#define INVALID_GLYPH ((uint32_t)-1)
+#define CACHE_VERSION 2
+#define DISTANCE_FIELD_PADDING 4
+#define DISTANCE_FIELD_EDGE 128
+#define DISTANCE_FIELD_SCALE ((float)DISTANCE_FIELD_EDGE / DISTANCE_FIELD_PADDING)
 
 namespace OctaneGUI
 {
@@ -43,19 +61,37 @@ Font::Range Font::Latin1Supplement { 0xA0, 0xFF };
 Font::Range Font::LatinExtended1 { 0x100, 0x17F };
 Font::Range Font::LatinExtended2 { 0x180, 0x24F };
 
-Font::Glyph::Glyph()
+std::shared_ptr<Font> Font::Create(const char* Path, float Size, const std::vector<Range>& Ranges, bool DistanceField)
 {
+    std::shared_ptr<Font> Result = std::make_shared<Font>();
+
+    if (!Result->Load(Path, Size, Ranges, DistanceField))
+    {
+        return nullptr;
+    }
+
+    return Result;
 }
 
-std::shared_ptr<Font> Font::Create(const char* Path, float Size, const std::vector<Range>& Ranges)
+std::shared_ptr<Font> Font::Create(const std::shared_ptr<Font>& Source, float Size)
 {
-    std::shared_ptr<Font> Result = std::make_shared<Font>();
-
-    if (!Result->Load(Path, Size, Ranges))
+    if (!Source || !Source->m_DistanceField || !Source->m_Texture)
     {
         return nullptr;
     }
 
+    const std::shared_ptr<Font>& Glyphs = Source->m_Source ? Source->m_Source : Source;
+    const float Scale = Size / Glyphs->m_Size;
+
+    std::shared_ptr<Font> Result = std::make_shared<Font>();
+    Result->m_Source = Glyphs;
+    Result->m_GlyphScale = Scale;
+    Result->m_DistanceField = true;
+    Result->m_Size = Size;
+    Result->m_Ascent = Glyphs->m_Ascent * Scale;
+    Result->m_Descent = Glyphs->m_Descent * Scale;
+    Result->m_Path = Glyphs->m_Path;
+    Result->m_SpaceSize = Result->Measure(U" ");
     return Result;
 }
 
@@ -69,6 +105,37 @@ int Font::TabSize()
     return s_TabSize;
 }
 
+void Font::SetGlyphCapacity(int Capacity)
+{
+    s_GlyphCapacity = Capacity;
+}
+
+int Font::GlyphCapacity()
+{
+    return s_GlyphCapacity;
+}
+
+void Font::SetCacheDirectory(const char* Directory)
+{
+    s_CacheDirectory = Directory != nullptr ? Directory : "";
+}
+
+const char* Font::CacheDirectory()
+{
+    return s_CacheDirectory.c_str();
+}
+
+void Font::NextFrame()
+{
+    s_Frame++;
+
+    for (const std::shared_ptr<Texture>& Item : s_Retired)
+    {
+        Item->Unload();
+    }
+    s_Retired.clear();
+}
+
 Font::Font()
 {
 }
@@ -77,6 +144,57 @@ Font::~Font()
 {
 }
 
+// Layout of a baked atlas cache file. The header is followed by the glyph offsets, sizes,
+// advances, texture coordinates, dense table, sparse table and the alpha pixels of the atlas.
+// Values are stored in the native byte order.
+struct FontCacheHeader
+{
+    char Magic[4] { 'O', 'G', 'F', 'C' };
+    uint32_t Version { CACHE_VERSION };
+    uint64_t Key { 0 };
+    float Ascent { 0.0f };
+    float Descent { 0.0f };
+    uint32_t Width { 0 };
+    uint32_t Height { 0 };
+    uint32_t Glyphs { 0 };
+    uint32_t DenseGlyphs { 0 };
+    uint32_t SparseGlyphs { 0 };
+    uint32_t MissingGlyph { 0 };
+    float CellOrigin[2] {};
+    float CellSize[2] {};
+    uint32_t CellColumns { 0 };
+    uint32_t Reserved { 0 };
+};
+
+static_assert(std::is_trivially_copyable<Vector2>::value && std::is_trivially_copyable<Rect>::value, "Glyph metrics must be trivially copyable to be cached.");
+
+uint64_t Hash(uint64_t Seed, const void* Data, size_t Size)
+{
+    // FNV-1a
+    const uint8_t* Bytes = static_cast<const uint8_t*>(Data);
+    uint64_t Result = Seed;
+    for (size_t I = 0; I < Size; I++)
+    {
+        Result ^= Bytes[I];
+        Result *= 0x100000001B3ULL;
+    }
+    return Result;
+}
+
+template <typename T>
+const uint8_t* ReadArray(const uint8_t* Cursor, std::vector<T>& Items, size_t Count)
+{
+    Items.resize(Count);
+    std::memcpy(Items.data(), Cursor, Count * sizeof(T));
+    return Cursor + Count * sizeof(T);
+}
+
+template <typename T>
+void WriteArray(std::ofstream& Stream, const std::vector<T>& Items, size_t Count)
+{
+    Stream.write(reinterpret_cast<const char*>(Items.data()), Count * sizeof(T));
+}
+
 void IncreaseSize(Vector2& TextureSize, float Delta)
 {
     if (TextureSize.Y < TextureSize.X)
@@ -89,46 +207,19 @@ void IncreaseSize(Vector2& TextureSize, float Delta)
     }
 }
 
-bool Font::Load(const char* Path, float Size, const std::vector<Range>& Ranges)
-{
-    std::ifstream Stream;
-    Stream.open(Path, std::ios_base::in | std::ios_base::binary);
-    if (!Stream.is_open())
-    {
-        return false;
-    }
-
-    Stream.seekg(0, std::ios_base::end);
-    size_t FileSize = Stream.tellg();
-    Stream.seekg(0, std::ios_base::beg);
-
-    std::vector<char> Buffer;
-    Buffer.resize(FileSize);
+// Glyphs outside of the atlas reserve their area once the size needed for the packed glyphs is known.
+typedef std::function<void(Vector2&)> ReserveSignature;
 
-    Stream.read(&Buffer[0], Buffer.size());
-    Stream.close();
-
-    float LineGap;
-    stbtt_GetScaledFontVMetrics((uint8_t*)Buffer.data(), 0, Size, &m_Ascent, &m_Descent, &LineGap);
-
-    m_Size = Size;
-    m_Path = Path;
-
-    // 1. Initialize the font data from the input stream.
-    Vector2 TextureSize { 128.0f, 128.0f };
-    const uint8_t* Data = (uint8_t*)Buffer.data();
-    stbtt_fontinfo Info {};
-    stbtt_InitFont(&Info, Data, stbtt_GetFontOffsetForIndex(Data, 0));
-
-    // 2. Begin our pack context. This initializes the stbtt_pack_context struct
+void BakeBitmaps(stbtt_fontinfo* Info, float Size, const std::vector<Font::Range>& Ranges, Vector2& TextureSize, const ReserveSignature& Reserve, std::vector<uint8_t>& Texture, std::vector<stbtt_packedchar>& Chars)
+{
+    // 1. Begin our pack context. This initializes the stbtt_pack_context struct
     stbtt_pack_context PackContext {};
     stbtt_PackBegin(&PackContext, nullptr, TextureSize.X, TextureSize.Y, 0, 1, nullptr);
 
-    // 3. Gather all rects to be rendered based on the desired character ranges.
-    std::vector<stbtt_packedchar> Chars;
+    // 2. Gather all rects to be rendered based on the desired character ranges.
     std::vector<stbrp_rect> AllRects;
     std::vector<stbtt_pack_range> PackRanges;
-    for (const Range& Range_ : Ranges)
+    for (const Font::Range& Range_ : Ranges)
     {
         PackRanges.push_back({});
         stbtt_pack_range& PackRange = PackRanges.back();
@@ -142,14 +233,14 @@ bool Font::Load(const char* Path, float Size, const std::vector<Range>& Ranges)
         std::vector<stbrp_rect> Rects;
         Rects.resize(PackRange.num_chars);
 
-        int PackedCount = stbtt_PackFontRangesGatherRects(&PackContext, &Info, &PackRange, 1, Rects.data());
+        int PackedCount = stbtt_PackFontRangesGatherRects(&PackContext, Info, &PackRange, 1, Rects.data());
         AllRects.insert(AllRects.end(), Rects.begin(), Rects.end());
 
         // Turn on skipping missing codepoints after the first range.
         stbtt_PackSetSkipMissingCodepoints(&PackContext, 1);
     }
 
-    // 4. Determine an appropriate texture size to render all of the glyphs into.
+    // 3. Determine an appropriate texture size to render all of the glyphs into.
     int Success = 0;
     do
     {
@@ -165,10 +256,11 @@ bool Font::Load(const char* Path, float Size, const std::vector<Range>& Ranges)
     }
     while (Success == 0);
 
+    Reserve(TextureSize);
+
     // Reset to not skip when rendering each rect.
     stbtt_PackSetSkipMissingCodepoints(&PackContext, 0);
 
-    std::vector<uint8_t> Texture;
     Texture.resize((int)TextureSize.X * (int)TextureSize.Y);
 
     PackContext.width = (int)TextureSize.X;
@@ -184,52 +276,287 @@ bool Font::Load(const char* Path, float Size, const std::vector<Range>& Ranges)
         Offset += Range_.num_chars;
     }
 
-    // 5. Perform the render.
-    Success = stbtt_PackFontRangesRenderIntoRects(&PackContext, &Info, PackRanges.data(), PackRanges.size(), AllRects.data());
+    // 4. Perform the render.
+    Success = stbtt_PackFontRangesRenderIntoRects(&PackContext, Info, PackRanges.data(), PackRanges.size(), AllRects.data());
 
     stbtt_PackEnd(&PackContext);
+}
 
-    // Convert data to RGBA32
-    std::vector<uint8_t> RGBA32;
-    RGBA32.resize((int)TextureSize.X * (int)TextureSize.Y * 4);
-    size_t Index = 0;
-    for (size_t I = 0; I < Texture.size(); I++)
+void BakeDistanceFields(stbtt_fontinfo* Info, float Scale, const std::vector<Font::Range>& Ranges, Vector2& TextureSize, const ReserveSignature& Reserve, std::vector<uint8_t>& Texture, std::vector<stbtt_packedchar>& Chars)
+{
+    // 1. Rasterize a distance field for each character. Code points missing from the font are
+    // skipped after the first range, the same as the bitmap atlas.
+    struct Field
     {
-        RGBA32[Index] = 255;
-        RGBA32[Index + 1] = 255;
-        RGBA32[Index + 2] = 255;
-        RGBA32[Index + 3] = Texture[I];
-        Index += 4;
+        std::vector<uint8_t> Pixels {};
+        int Width { 0 };
+        int Height { 0 };
+    };
+
+    std::vector<Field> Fields;
+    std::vector<stbrp_rect> Rects;
+    for (size_t RangeIndex = 0; RangeIndex < Ranges.size(); RangeIndex++)
+    {
+        const Font::Range& Range_ = Ranges[RangeIndex];
+        for (uint32_t CodePoint = Range_.Min; CodePoint <= Range_.Max; CodePoint++)
+        {
+            Fields.push_back({});
+            Chars.push_back({});
+            Field& Item = Fields.back();
+            stbtt_packedchar& Char = Chars.back();
+
+            const int Glyph = stbtt_FindGlyphIndex(Info, (int)CodePoint);
+            if (Glyph == 0 && RangeIndex > 0)
+            {
+                continue;
+            }
+
+            int Advance, Bearing;
+            stbtt_GetGlyphHMetrics(Info, Glyph, &Advance, &Bearing);
+            Char.xadvance = Scale * Advance;
+
+            int XOff = 0, YOff = 0;
+            uint8_t* Pixels = stbtt_GetGlyphSDF(Info, Scale, Glyph, DISTANCE_FIELD_PADDING, DISTANCE_FIELD_EDGE, DISTANCE_FIELD_SCALE, &Item.Width, &Item.Height, &XOff, &YOff);
+            if (Pixels != nullptr)
+            {
+                Item.Pixels.assign(Pixels, Pixels + Item.Width * Item.Height);
+                stbtt_FreeSDF(Pixels, nullptr);
+            }
+
+            Char.xoff = (float)XOff;
+            Char.yoff = (float)YOff;
+            Char.xoff2 = (float)(XOff + Item.Width);
+            Char.yoff2 = (float)(YOff + Item.Height);
+
+            // Keep a one pixel gap between fields.
+            stbrp_rect Rect_ {};
+            Rect_.id = (int)Fields.size() - 1;
+            Rect_.w = Item.Width > 0 ? Item.Width + 1 : 0;
+            Rect_.h = Item.Height > 0 ? Item.Height + 1 : 0;
+            Rects.push_back(Rect_);
+        }
     }
 
-    m_Texture = Texture::Load(RGBA32, (uint32_t)TextureSize.X, (uint32_t)TextureSize.Y);
-    if (!m_Texture)
+    // 2. Determine an appropriate texture size to pack all of the fields into.
+    int Success = 0;
+    do
+    {
+        stbrp_context Context {};
+        std::vector<stbrp_node> Nodes;
+        Nodes.resize((int)TextureSize.X);
+        stbrp_init_target(&Context, (int)TextureSize.X, (int)TextureSize.Y, Nodes.data(), Nodes.size());
+        Success = stbrp_pack_rects(&Context, Rects.data(), Rects.size());
+        if (Success == 0)
+        {
+            IncreaseSize(TextureSize, 128.0f);
+        }
+    }
+    while (Success == 0);
+
+    Reserve(TextureSize);
+
+    // 3. Copy each field into its packed rect.
+    const int Width = (int)TextureSize.X;
+    Texture.resize(Width * (int)TextureSize.Y);
+    for (const stbrp_rect& Rect_ : Rects)
+    {
+        const Field& Item = Fields[Rect_.id];
+        stbtt_packedchar& Char = Chars[Rect_.id];
+        for (int Y = 0; Y < Item.Height; Y++)
+        {
+            std::memcpy(&Texture[(Rect_.y + Y) * Width + Rect_.x], &Item.Pixels[Y * Item.Width], Item.Width);
+        }
+
+        Char.x0 = (unsigned short)Rect_.x;
+        Char.y0 = (unsigned short)Rect_.y;
+        Char.x1 = (unsigned short)(Rect_.x + Item.Width);
+        Char.y1 = (unsigned short)(Rect_.y + Item.Height);
+    }
+}
+
+bool Font::Load(const char* Path, float Size, const std::vector<Range>& Ranges, bool DistanceField)
+{
+    return Bake(Path, Size, Ranges, DistanceField) && Upload();
+}
+
+bool Font::Bake(const char* Path, float Size, const std::vector<Range>& Ranges, bool DistanceField)
+{
+    // The font file is kept mapped to rasterize glyphs that are not part of the given ranges.
+    if (!m_FontFile.Open(Path))
     {
         return false;
     }
 
-    // 6. Map each character rect to a glyph object.
-    Index = 0;
+    const uint8_t* Data = m_FontFile.Data();
+
+    float LineGap;
+    stbtt_GetScaledFontVMetrics(Data, 0, Size, &m_Ascent, &m_Descent, &LineGap);
+
+    m_Size = Size;
+    m_Path = Path;
+    m_DistanceField = DistanceField;
+    m_Texture = nullptr;
+
+    // 1. Initialize the font data from the mapped file.
+    Vector2 TextureSize { 128.0f, 128.0f };
+    m_Info = std::make_unique<stbtt_fontinfo>();
+    stbtt_InitFont(m_Info.get(), Data, stbtt_GetFontOffsetForIndex(Data, 0));
+    m_Scale = stbtt_ScaleForPixelHeight(m_Info.get(), Size);
+
+    const uint32_t Capacity = s_GlyphCapacity > 0 ? (uint32_t)s_GlyphCapacity : 0;
+    m_CellCodePoints.assign(Capacity, INVALID_GLYPH);
+    m_CellLastUsed.assign(Capacity, 0);
+    m_CellFrames.assign(Capacity, 0);
+    m_GlyphClock = 0;
+
+    // Use a previously baked atlas if one exists for the same font file, size and ranges.
+    std::string CachePath;
+    const uint64_t Key = CacheKey(Ranges, Capacity);
+    if (!s_CacheDirectory.empty())
+    {
+        char Name[32] {};
+        std::snprintf(Name, sizeof(Name), "%016llx.fontcache", (unsigned long long)Key);
+        CachePath = (std::filesystem::path(s_CacheDirectory) / Name).string();
+
+        if (ReadCache(CachePath, Key, Capacity))
+        {
+            m_SpaceSize = Measure(U" ");
+            return true;
+        }
+    }
+
+    std::vector<stbtt_packedchar> Chars;
+    std::vector<uint8_t> Texture;
+    const ReserveSignature Reserve = [this, Capacity](Vector2& Size) -> void
+    {
+        ReserveCells(Capacity, Size);
+    };
+
+    if (m_DistanceField)
+    {
+        BakeDistanceFields(m_Info.get(), m_Scale, Ranges, TextureSize, Reserve, Texture, Chars);
+    }
+    else
+    {
+        BakeBitmaps(m_Info.get(), Size, Ranges, TextureSize, Reserve, Texture, Chars);
+    }
+
+    // 2. Map each character rect to a glyph index.
+    const Vector2 InvertedSize = TextureSize.Invert();
+    m_DynamicGlyphs = (uint32_t)Chars.size();
+    m_GlyphOffsets.resize(m_DynamicGlyphs + Capacity);
+    m_GlyphSizes.resize(m_DynamicGlyphs + Capacity);
+    m_GlyphAdvances.resize(m_DynamicGlyphs + Capacity);
+    m_GlyphUVs.resize(m_DynamicGlyphs + Capacity);
+    m_DenseGlyphs.clear();
+    m_SparseGlyphs.clear();
+    m_MissingGlyph = 0;
+
+    size_t Index = 0;
     for (const Range& Range_ : Ranges)
     {
         for (unsigned int Codepoint = Range_.Min; Codepoint <= Range_.Max; Codepoint++)
         {
-            const stbtt_packedchar& PackedChar = Chars[Index++];
-            Glyph& Item = m_Glyphs[Codepoint];
-            Item.Min = { (float)PackedChar.x0, (float)PackedChar.y0 };
-            Item.Max = { (float)PackedChar.x1, (float)PackedChar.y1 };
-            Item.Offset = { (float)PackedChar.xoff, (float)PackedChar.yoff };
-            Item.Offset2 = { (float)PackedChar.xoff2, (float)PackedChar.yoff2 };
-            Item.Advance = { PackedChar.xadvance, 0.0f };
+            const stbtt_packedchar& PackedChar = Chars[Index];
+            const Vector2 Offset { (float)PackedChar.xoff, (float)PackedChar.yoff };
+            const Vector2 Offset2 { (float)PackedChar.xoff2, (float)PackedChar.yoff2 };
+            m_GlyphOffsets[Index] = Offset;
+            m_GlyphSizes[Index] = Offset2 - Offset;
+            m_GlyphAdvances[Index] = PackedChar.xadvance;
+            m_GlyphUVs[Index] = {
+                Vector2((float)PackedChar.x0, (float)PackedChar.y0) * InvertedSize,
+                Vector2((float)PackedChar.x1, (float)PackedChar.y1) * InvertedSize
+            };
+
+            if (Codepoint < DENSE_GLYPH_LIMIT)
+            {
+                if (Codepoint >= m_DenseGlyphs.size())
+                {
+                    m_DenseGlyphs.resize(Codepoint + 1, INVALID_GLYPH);
+                }
+
+                m_DenseGlyphs[Codepoint] = Index;
+            }
+            else
+            {
+                m_SparseGlyphs.push_back({ Codepoint, Index });
+            }
+
+            Index++;
         }
     }
 
+    std::sort(m_SparseGlyphs.begin(), m_SparseGlyphs.end());
+
+    // TODO: Currently, we are hardcoding the missing character glyph to this character.
+    // Should come up with a more generic solution.
+    const uint32_t Missing = GlyphIndex(127);
+    m_MissingGlyph = Missing == INVALID_GLYPH ? 0 : Missing;
+
+    if (!CachePath.empty())
+    {
+        WriteCache(CachePath, Key, Texture, (uint32_t)TextureSize.X, (uint32_t)TextureSize.Y);
+    }
+
+    SetAtlas(Texture.data(), (uint32_t)TextureSize.X, (uint32_t)TextureSize.Y);
     m_SpaceSize = Measure(U" ");
 
     return true;
 }
 
-bool Font::Draw(uint32_t Char, Vector2& Position, Rect& Vertices, Rect& TexCoords) const
+bool Font::Upload()
+{
+    if (m_Atlas.empty() || m_Texture)
+    {
+        return m_Texture != nullptr;
+    }
+
+    m_Texture = Texture::LoadShared(m_Atlas, m_AtlasWidth, m_AtlasHeight);
+    if (m_CellCodePoints.empty())
+    {
+        m_Atlas.clear();
+        m_Atlas.shrink_to_fit();
+    }
+
+    // The glyph coordinates are relative to this font's atlas, which may now be part of a larger page.
+    if (m_Texture && m_Texture->IsShared())
+    {
+        const Vector2 Size = m_Texture->GetSize();
+        for (Rect& UV : m_GlyphUVs)
+        {
+            UV = m_Texture->Normalize({ UV.Min * Size, UV.Max * Size });
+        }
+    }
+
+    return m_Texture != nullptr;
+}
+
+void Font::ReserveCells(uint32_t Capacity, Vector2& TextureSize)
+{
+    // Reserve an area at the bottom of the atlas for glyphs that are loaded on demand. Each glyph
+    // is given a cell large enough to fit any glyph in the font.
+    if (Capacity == 0)
+    {
+        return;
+    }
+
+    int X0, Y0, X1, Y1;
+    stbtt_GetFontBoundingBox(m_Info.get(), &X0, &Y0, &X1, &Y1);
+
+    // One pixel is added to keep a gap between cells. Distance fields also extend past the glyph
+    // by their padding on each side.
+    const float Padding = m_DistanceField ? DISTANCE_FIELD_PADDING * 2.0f : 0.0f;
+    m_CellSize = { std::ceil((X1 - X0) * m_Scale) + Padding + 1.0f, std::ceil((Y1 - Y0) * m_Scale) + Padding + 1.0f };
+    m_CellColumns = std::max<uint32_t>((uint32_t)(TextureSize.X / m_CellSize.X), 1);
+    TextureSize.X = std::max<float>(TextureSize.X, m_CellSize.X * m_CellColumns);
+
+    const uint32_t Rows = (Capacity + m_CellColumns - 1) / m_CellColumns;
+    m_CellOrigin = { 0.0f, TextureSize.Y };
+    TextureSize.Y += m_CellSize.Y * Rows;
+}
+
+
+bool Font::Draw(uint32_t Char, Vector2& Position, Rect& Vertices, Rect& TexCoords, std::vector<uint32_t>* Cells) const
 {
     const bool IsTab = Char == '\t';
     if (IsTab)
@@ -237,27 +564,44 @@ bool Font::Draw(uint32_t Char, Vector2& Position, Rect& Vertices, Rect& TexCoord
         Char = ' ';
     }
 
-    const Glyph& Item = GetGlyph(Char);
-    const Vector2 InvertedSize = m_Texture->GetSize().Invert();
-    const Vector2 DiffOffset = Item.Offset2 - Item.Offset;
+    // Fonts created from a distance field font draw the glyphs of that font scaled to their size.
+    const Font& Glyphs = m_Source ? *m_Source : *this;
+    uint32_t Index = Glyphs.GlyphIndex(Char);
+    if (Index == INVALID_GLYPH)
+    {
+        Index = Glyphs.LoadGlyph(Char);
+    }
+    else if (Index >= Glyphs.m_DynamicGlyphs)
+    {
+        Glyphs.m_CellLastUsed[Index - Glyphs.m_DynamicGlyphs] = ++Glyphs.m_GlyphClock;
+        Glyphs.m_CellFrames[Index - Glyphs.m_DynamicGlyphs] = s_Frame;
+    }
+
+    if (Cells != nullptr && Index >= Glyphs.m_DynamicGlyphs)
+    {
+        Cells->push_back(Index - Glyphs.m_DynamicGlyphs);
+    }
+
+    const Vector2 Offset = Glyphs.m_GlyphOffsets[Index] * m_GlyphScale;
+    const Vector2 DiffOffset = Glyphs.m_GlyphSizes[Index] * m_GlyphScale;
+    const float Advance = Glyphs.m_GlyphAdvances[Index] * m_GlyphScale;
 
-    int X = (int)floor(Position.X + Item.Offset.X + 0.5f);
-    int Y = (int)floor(Position.Y + Item.Offset.Y + m_Ascent + 0.5f);
+    int X = (int)floor(Position.X + Offset.X + 0.5f);
+    int Y = (int)floor(Position.Y + Offset.Y + m_Ascent + 0.5f);
 
     Vertices.Min = Vector2((float)X, (float)Y);
     Vertices.Max = Vertices.Min + DiffOffset;
 
-    TexCoords.Min = Item.Min * InvertedSize;
-    TexCoords.Max = Item.Max * InvertedSize;
+    TexCoords = Glyphs.m_GlyphUVs[Index];
 
-    Position += Item.Advance;
+    Position.X += Advance;
 
     if (IsTab)
     {
         // Need to subtract one as a space offset has already been added above.
         const float TabSize = (float)(s_TabSize - 1);
         Vertices.Max += DiffOffset * Vector2(TabSize, 0.0);
-        Position.X += Item.Advance.X * TabSize;
+        Position.X += Advance * TabSize;
     }
 
     return true;
@@ -370,6 +714,11 @@ Vector2 Font::Measure(uint32_t CodePoint) const
 
 uint32_t Font::ID() const
 {
+    if (m_Source)
+    {
+        return m_Source->ID();
+    }
+
     if (!m_Texture)
     {
         return 0;
@@ -405,21 +754,470 @@ const char* Font::Path() const
 
 const std::shared_ptr<Texture>& Font::GetTexture() const
 {
+    if (m_Source)
+    {
+        return m_Source->GetTexture();
+    }
+
     return m_Texture;
 }
 
-const Font::Glyph& Font::GetGlyph(uint32_t CodePoint) const
+uint32_t Font::GlyphIndex(uint32_t CodePoint) const
+{
+    if (CodePoint < m_DenseGlyphs.size())
+    {
+        return m_DenseGlyphs[CodePoint];
+    }
+
+    if (m_SparseGlyphs.empty() || CodePoint < DENSE_GLYPH_LIMIT)
+    {
+        return INVALID_GLYPH;
+    }
+
+    const std::pair<uint32_t, uint32_t> Key { CodePoint, 0 };
+    const auto It = std::lower_bound(m_SparseGlyphs.begin(), m_SparseGlyphs.end(), Key);
+    return It != m_SparseGlyphs.end() && It->first == CodePoint ? It->second : INVALID_GLYPH;
+}
+
+uint32_t Font::DynamicGlyphCount() const
+{
+    if (m_Source)
+    {
+        return m_Source->DynamicGlyphCount();
+    }
+
+    return (uint32_t)std::count_if(m_CellCodePoints.begin(), m_CellCodePoints.end(), [](uint32_t CodePoint) -> bool
+        {
+            return CodePoint != INVALID_GLYPH;
+        });
+}
+
+uint32_t Font::GlyphRevision() const
+{
+    if (m_Source)
+    {
+        return m_Source->GlyphRevision();
+    }
+
+    return m_GlyphRevision;
+}
+
+void Font::UseCells(const std::vector<uint32_t>& Cells) const
+{
+    const Font& Glyphs = m_Source ? *m_Source : *this;
+    for (uint32_t Cell : Cells)
+    {
+        if (Cell < Glyphs.m_CellFrames.size())
+        {
+            Glyphs.m_CellLastUsed[Cell] = ++Glyphs.m_GlyphClock;
+            Glyphs.m_CellFrames[Cell] = s_Frame;
+        }
+    }
+}
+
+bool Font::DistanceField() const
+{
+    return m_DistanceField;
+}
+
+uint32_t Font::LoadGlyph(uint32_t CodePoint) const
+{
+    // Control characters are never rasterized so that they are measured the same as before.
+    const bool IsControl = CodePoint < 0x20 || (CodePoint >= 0x7F && CodePoint < 0xA0);
+    const int Glyph = m_Info && m_Texture && !m_CellCodePoints.empty() && !IsControl && Texture::CanUpdate()
+        ? stbtt_FindGlyphIndex(m_Info.get(), (int)CodePoint)
+        : 0;
+
+    if (Glyph == 0)
+    {
+        // The glyph is looked up again once the texture is uploaded.
+        if (m_Texture || m_CellCodePoints.empty())
+        {
+            SetGlyphIndex(CodePoint, m_MissingGlyph);
+        }
+
+        return m_MissingGlyph;
+    }
+
+    // Free cells have never been used, so they are picked before any glyph is replaced.
+    uint32_t Cell = 0;
+    for (uint32_t I = 1; I < (uint32_t)m_CellLastUsed.size(); I++)
+    {
+        if (m_CellLastUsed[I] < m_CellLastUsed[Cell])
+        {
+            Cell = I;
+        }
+    }
+
+    // The least recently used glyph may already be drawn this frame, in which case
+    // the first of the new cells is used.
+    if (m_CellFrames[Cell] == s_Frame)
+    {
+        Cell = (uint32_t)m_CellCodePoints.size();
+        if (!GrowCells())
+        {
+            return m_MissingGlyph;
+        }
+    }
+
+    if (m_CellCodePoints[Cell] != INVALID_GLYPH)
+    {
+        RemoveGlyphIndex(m_CellCodePoints[Cell]);
+        m_GlyphRevision++;
+    }
+
+    const int CellWidth = (int)m_CellSize.X;
+    const int CellHeight = (int)m_CellSize.Y;
+
+    int X0, Y0, X1, Y1;
+    stbtt_GetGlyphBitmapBox(m_Info.get(), Glyph, m_Scale, m_Scale, &X0, &Y0, &X1, &Y1);
+
+    uint8_t* Field = nullptr;
+    if (m_DistanceField)
+    {
+        int FieldWidth = 0, FieldHeight = 0;
+        Field = stbtt_GetGlyphSDF(m_Info.get(), m_Scale, Glyph, DISTANCE_FIELD_PADDING, DISTANCE_FIELD_EDGE, DISTANCE_FIELD_SCALE, &FieldWidth, &FieldHeight, &X0, &Y0);
+        X1 = X0 + FieldWidth;
+        Y1 = Y0 + FieldHeight;
+    }
+
+    // Keep the gap on the right and bottom of the cell clear.
+    const int Width = std::min<int>(X1 - X0, CellWidth - 1);
+    const int Height = std::min<int>(Y1 - Y0, CellHeight - 1);
+
+    std::vector<uint8_t> Alpha;
+    Alpha.resize(CellWidth * CellHeight);
+    if (Field != nullptr)
+    {
+        for (int Y = 0; Y < Height; Y++)
+        {
+            std::memcpy(&Alpha[Y * CellWidth], &Field[Y * (X1 - X0)], Width);
+        }
+
+        stbtt_FreeSDF(Field, nullptr);
+    }
+    else if (Width > 0 && Height > 0 && !m_DistanceField)
+    {
+        stbtt_MakeGlyphBitmap(m_Info.get(), Alpha.data(), Width, Height, CellWidth, m_Scale, m_Scale, Glyph);
+    }
+
+    // The whole cell is uploaded to clear out the previous glyph.
+    std::vector<uint8_t> RGBA32;
+    RGBA32.resize(Alpha.size() * 4);
+    for (size_t I = 0; I < Alpha.size(); I++)
+    {
+        RGBA32[I * 4] = 255;
+        RGBA32[I * 4 + 1] = 255;
+        RGBA32[I * 4 + 2] = 255;
+        RGBA32[I * 4 + 3] = Alpha[I];
+    }
+
+    // The cell is left free if the upload fails and the glyph is looked up again the next time.
+    const Vector2 Position = m_CellOrigin + Vector2((float)(Cell % m_CellColumns), (float)(Cell / m_CellColumns)) * m_CellSize;
+    if (!m_Texture->Update(RGBA32, (uint32_t)Position.X, (uint32_t)Position.Y, (uint32_t)CellWidth, (uint32_t)CellHeight))
+    {
+        m_CellCodePoints[Cell] = INVALID_GLYPH;
+        m_CellLastUsed[Cell] = 0;
+        return m_MissingGlyph;
+    }
+
+    for (int Y = 0; Y < CellHeight; Y++)
+    {
+        const size_t Offset = (((size_t)Position.Y + Y) * m_AtlasWidth + (size_t)Position.X) * 4;
+        std::memcpy(&m_Atlas[Offset], &RGBA32[(size_t)Y * CellWidth * 4], (size_t)CellWidth * 4);
+    }
+
+    int Advance, Bearing;
+    stbtt_GetGlyphHMetrics(m_Info.get(), Glyph, &Advance, &Bearing);
+
+    const uint32_t Index = m_DynamicGlyphs + Cell;
+    const Vector2 Size { (float)Width, (float)Height };
+    m_GlyphOffsets[Index] = { (float)X0, (float)Y0 };
+    m_GlyphSizes[Index] = Size;
+    m_GlyphAdvances[Index] = m_Scale * Advance;
+    m_GlyphUVs[Index] = m_Texture->Normalize({ Position, Position + Size });
+
+    m_CellCodePoints[Cell] = CodePoint;
+    m_CellLastUsed[Cell] = ++m_GlyphClock;
+    m_CellFrames[Cell] = s_Frame;
+    SetGlyphIndex(CodePoint, Index);
+
+    return Index;
+}
+
+bool Font::GrowCells() const
 {
-    if (m_Glyphs.find(CodePoint) == m_Glyphs.end())
+    // Doubles the rows of cells by uploading the kept atlas pixels to a taller texture. Quads
+    // already drawn this frame still refer to the previous texture, so it is only unloaded
+    // once the frame ends.
+    const uint32_t Rows = ((uint32_t)m_CellCodePoints.size() + m_CellColumns - 1) / m_CellColumns;
+    const uint32_t Capacity = Rows * 2 * m_CellColumns;
+    const uint32_t Height = (uint32_t)m_CellOrigin.Y + (uint32_t)(m_CellSize.Y * Rows * 2);
+
+    std::vector<uint8_t> Atlas { m_Atlas };
+    Atlas.resize((size_t)m_AtlasWidth * Height * 4, 255);
+    for (size_t I = m_Atlas.size() + 3; I < Atlas.size(); I += 4)
+    {
+        Atlas[I] = 0;
+    }
+
+    const std::shared_ptr<Texture> Grown = Texture::Load(Atlas, m_AtlasWidth, Height);
+    if (!Grown)
+    {
+        return false;
+    }
+
+    // Convert the glyph coordinates back to pixels within the previous texture.
+    const Vector2 Size = m_Texture->GetSize();
+    const Rect Bounds = m_Texture->Normalize({ {}, Size });
+    const Vector2 Scale = Size / Bounds.GetSize();
+    for (Rect& UV : m_GlyphUVs)
+    {
+        UV = Grown->Normalize({ (UV.Min - Bounds.Min) * Scale, (UV.Max - Bounds.Min) * Scale });
+    }
+
+    const size_t Count = m_DynamicGlyphs + Capacity;
+    m_GlyphOffsets.resize(Count);
+    m_GlyphSizes.resize(Count);
+    m_GlyphAdvances.resize(Count);
+    m_GlyphUVs.resize(Count);
+    m_CellCodePoints.resize(Capacity, INVALID_GLYPH);
+    m_CellLastUsed.resize(Capacity, 0);
+    m_CellFrames.resize(Capacity, 0);
+    m_Atlas = std::move(Atlas);
+    m_AtlasHeight = Height;
+    s_Retired.push_back(m_Texture);
+    m_Texture = Grown;
+    m_GlyphRevision++;
+
+    return true;
+}
+
+void Font::SetGlyphIndex(uint32_t CodePoint, uint32_t Index) const
+{
+    if (CodePoint < DENSE_GLYPH_LIMIT)
+    {
+        if (CodePoint >= m_DenseGlyphs.size())
+        {
+            m_DenseGlyphs.resize(CodePoint + 1, INVALID_GLYPH);
+        }
+
+        m_DenseGlyphs[CodePoint] = Index;
+        return;
+    }
+
+    const std::pair<uint32_t, uint32_t> Key { CodePoint, 0 };
+    const auto It = std::lower_bound(m_SparseGlyphs.begin(), m_SparseGlyphs.end(), Key);
+    if (It != m_SparseGlyphs.end() && It->first == CodePoint)
+    {
+        It->second = Index;
+    }
+    else
+    {
+        m_SparseGlyphs.insert(It, { CodePoint, Index });
+    }
+}
+
+void Font::RemoveGlyphIndex(uint32_t CodePoint) const
+{
+    if (CodePoint < DENSE_GLYPH_LIMIT)
+    {
+        m_DenseGlyphs[CodePoint] = INVALID_GLYPH;
+        return;
+    }
+
+    const std::pair<uint32_t, uint32_t> Key { CodePoint, 0 };
+    const auto It = std::lower_bound(m_SparseGlyphs.begin(), m_SparseGlyphs.end(), Key);
+    if (It != m_SparseGlyphs.end() && It->first == CodePoint)
+    {
+        m_SparseGlyphs.erase(It);
+    }
+}
+
+void Font::SetAtlas(const uint8_t* Alpha, uint32_t Width, uint32_t Height)
+{
+    // Convert data to RGBA32
+    m_Atlas.resize((size_t)Width * Height * 4);
+    size_t Index = 0;
+    for (size_t I = 0; I < (size_t)Width * Height; I++)
+    {
+        m_Atlas[Index] = 255;
+        m_Atlas[Index + 1] = 255;
+        m_Atlas[Index + 2] = 255;
+        m_Atlas[Index + 3] = Alpha[I];
+        Index += 4;
+    }
+
+    m_AtlasWidth = Width;
+    m_AtlasHeight = Height;
+}
+
+uint64_t Font::CacheKey(const std::vector<Range>& Ranges, uint32_t Capacity) const
+{
+    uint64_t Result = Hash(0xCBF29CE484222325ULL, m_FontFile.Data(), m_FontFile.Size());
+    Result = Hash(Result, &m_Size, sizeof(m_Size));
+    Result = Hash(Result, &m_DistanceField, sizeof(m_DistanceField));
+    for (const Range& Range_ : Ranges)
+    {
+        Result = Hash(Result, &Range_.Min, sizeof(Range_.Min));
+        Result = Hash(Result, &Range_.Max, sizeof(Range_.Max));
+    }
+    return Hash(Result, &Capacity, sizeof(Capacity));
+}
+
+bool Font::ReadCache(const std::string& Path, uint64_t Key, uint32_t Capacity)
+{
+    MappedFile File;
+    if (!File.Open(Path.c_str()) || File.Size() < sizeof(FontCacheHeader))
+    {
+        return false;
+    }
+
+    const FontCacheHeader Expected {};
+    FontCacheHeader Header {};
+    std::memcpy(&Header, File.Data(), sizeof(Header));
+    if (std::memcmp(Header.Magic, Expected.Magic, sizeof(Header.Magic)) != 0 || Header.Version != Expected.Version || Header.Key != Key)
+    {
+        return false;
+    }
+
+    const size_t GlyphSize = sizeof(Vector2) * 2 + sizeof(float) + sizeof(Rect);
+    const size_t Size = sizeof(Header)
+        + Header.Glyphs * GlyphSize
+        + Header.DenseGlyphs * sizeof(uint32_t)
+        + Header.SparseGlyphs * sizeof(uint32_t) * 2
+        + (size_t)Header.Width * Header.Height;
+    if (File.Size() != Size)
+    {
+        return false;
+    }
+
+    if (Header.MissingGlyph >= Header.Glyphs || Header.DenseGlyphs > DENSE_GLYPH_LIMIT || (Capacity > 0 && Header.CellColumns == 0))
+    {
+        return false;
+    }
+
+    // Every glyph index in the lookup tables must refer to a cached glyph and the sparse
+    // code points must be sorted for the binary search.
+    std::vector<uint32_t> Dense;
+    std::vector<uint32_t> Sparse;
+    const uint8_t* Cursor = File.Data() + sizeof(Header) + Header.Glyphs * GlyphSize;
+    Cursor = ReadArray(Cursor, Dense, Header.DenseGlyphs);
+    Cursor = ReadArray(Cursor, Sparse, Header.SparseGlyphs * 2);
+
+    for (uint32_t Index : Dense)
+    {
+        if (Index != INVALID_GLYPH && Index >= Header.Glyphs)
+        {
+            return false;
+        }
+    }
+
+    for (uint32_t I = 0; I < Header.SparseGlyphs; I++)
+    {
+        const uint32_t CodePoint = Sparse[I * 2];
+        if (CodePoint < DENSE_GLYPH_LIMIT || Sparse[I * 2 + 1] >= Header.Glyphs || (I > 0 && CodePoint <= Sparse[I * 2 - 2]))
+        {
+            return false;
+        }
+    }
+
+    const uint8_t* Glyphs = File.Data() + sizeof(Header);
+    Glyphs = ReadArray(Glyphs, m_GlyphOffsets, Header.Glyphs);
+    Glyphs = ReadArray(Glyphs, m_GlyphSizes, Header.Glyphs);
+    Glyphs = ReadArray(Glyphs, m_GlyphAdvances, Header.Glyphs);
+    ReadArray(Glyphs, m_GlyphUVs, Header.Glyphs);
+
+    m_DenseGlyphs = std::move(Dense);
+    m_SparseGlyphs.resize(Header.SparseGlyphs);
+    for (uint32_t I = 0; I < Header.SparseGlyphs; I++)
+    {
+        m_SparseGlyphs[I] = { Sparse[I * 2], Sparse[I * 2 + 1] };
+    }
+
+    // Space for the glyphs loaded on demand is not part of the cache.
+    m_DynamicGlyphs = Header.Glyphs;
+    m_GlyphOffsets.resize(m_DynamicGlyphs + Capacity);
+    m_GlyphSizes.resize(m_DynamicGlyphs + Capacity);
+    m_GlyphAdvances.resize(m_DynamicGlyphs + Capacity);
+    m_GlyphUVs.resize(m_DynamicGlyphs + Capacity);
+
+    m_Ascent = Header.Ascent;
+    m_Descent = Header.Descent;
+    m_MissingGlyph = Header.MissingGlyph;
+    m_CellOrigin = { Header.CellOrigin[0], Header.CellOrigin[1] };
+    m_CellSize = { Header.CellSize[0], Header.CellSize[1] };
+    m_CellColumns = Header.CellColumns;
+
+    SetAtlas(Cursor, Header.Width, Header.Height);
+    return true;
+}
+
+void Font::WriteCache(const std::string& Path, uint64_t Key, const std::vector<uint8_t>& Alpha, uint32_t Width, uint32_t Height) const
+{
+    std::error_code Error;
+    std::filesystem::create_directories(std::filesystem::path(Path).parent_path(), Error);
+
+    FontCacheHeader Header {};
+    Header.Key = Key;
+    Header.Ascent = m_Ascent;
+    Header.Descent = m_Descent;
+    Header.Width = Width;
+    Header.Height = Height;
+    Header.Glyphs = m_DynamicGlyphs;
+    Header.DenseGlyphs = (uint32_t)m_DenseGlyphs.size();
+    Header.SparseGlyphs = (uint32_t)m_SparseGlyphs.size();
+    Header.MissingGlyph = m_MissingGlyph;
+    Header.CellOrigin[0] = m_CellOrigin.X;
+    Header.CellOrigin[1] = m_CellOrigin.Y;
+    Header.CellSize[0] = m_CellSize.X;
+    Header.CellSize[1] = m_CellSize.Y;
+    Header.CellColumns = m_CellColumns;
+
+    std::vector<uint32_t> Sparse;
+    for (const std::pair<uint32_t, uint32_t>& Item : m_SparseGlyphs)
+    {
+        Sparse.push_back(Item.first);
+        Sparse.push_back(Item.second);
+    }
+
+    // Write to a temporary file first so that other processes never map a partially written cache.
+    // The name is unique to this process so that processes baking the same font do not share it.
+#if defined(WINDOWS)
+    const std::string Temp = Path + "." + std::to_string(_getpid()) + ".tmp";
+#else
+    const std::string Temp = Path + "." + std::to_string(getpid()) + ".tmp";
+#endif
+    std::ofstream Stream;
+    Stream.open(Temp, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!Stream.is_open())
+    {
+        return;
+    }
+
+    Stream.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+    WriteArray(Stream, m_GlyphOffsets, m_DynamicGlyphs);
+    WriteArray(Stream, m_GlyphSizes, m_DynamicGlyphs);
+    WriteArray(Stream, m_GlyphAdvances, m_DynamicGlyphs);
+    WriteArray(Stream, m_GlyphUVs, m_DynamicGlyphs);
+    WriteArray(Stream, m_DenseGlyphs, m_DenseGlyphs.size());
+    WriteArray(Stream, Sparse, Sparse.size());
+    WriteArray(Stream, Alpha, (size_t)Width * Height);
+    Stream.close();
+
+    if (Stream.fail())
     {
-        // TODO: Currently, we are hardcoding the missing character glyph to this character.
-        // Should come up with a more generic solution.
-        CodePoint = 127;
+        std::filesystem::remove(Temp, Error);
+        return;
     }
 
-    return m_Glyphs.at(CodePoint);
+    std::filesystem::rename(Temp, Path, Error);
 }
 
 int Font::s_TabSize { 4 };
+int Font::s_GlyphCapacity { 256 };
+std::string Font::s_CacheDirectory {};
+uint64_t Font::s_Frame { 1 };
+std::vector<std::shared_ptr<Texture>> Font::s_Retired {};
 
 }
@@ -26,20 +26,21 @@ SOFTWARE.
 
 #pragma once
 
-#include "Vector2.h"
+#include "MappedFile.h"
+#include "Rect.h"
+
+struct stbtt_fontinfo;
 
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 #include <vector>
 
 namespace OctaneGUI
 {
 
-struct Rect;
 class Texture;
 
 class Font
@@ -56,27 +57,75 @@ public:
     static Range LatinExtended1;
     static Range LatinExtended2;
 
-    struct Glyph
-    {
-    public:
-        Glyph();
-
-        Vector2 Min {};
-        Vector2 Max {};
-        Vector2 Offset {};
-        Vector2 Offset2 {};
-        Vector2 Advance {};
-    };
-
-    static std::shared_ptr<Font> Create(const char* Path, float Size, const std::vector<Range>& Ranges = { BasicLatin, Latin1Supplement });
+    /// @brief Loads a font file rasterized at the given size.
+    ///
+    /// A distance field font stores the distance to the edge of each glyph in its atlas
+    /// instead of the glyph's coverage. These can be drawn at any scale by creating a font
+    /// from it with Create(Source, Size). Its draw commands are flagged so the renderer can
+    /// convert the distances to coverage.
+    static std::shared_ptr<Font> Create(const char* Path, float Size, const std::vector<Range>& Ranges = { BasicLatin, Latin1Supplement }, bool DistanceField = false);
+
+    /// @brief Creates a font at a new size that draws the glyphs of a distance field font.
+    ///
+    /// Nothing is rasterized and the atlas texture is shared with the source font.
+    ///
+    /// @param Source A font loaded as a distance field.
+    /// @param Size Size of the new font.
+    /// @return The new font, or nullptr if the source is not a distance field font.
+    static std::shared_ptr<Font> Create(const std::shared_ptr<Font>& Source, float Size);
     static void SetTabSize(int TabSize);
     static int TabSize();
 
+    /// @brief Sets the number of glyphs outside of the loaded ranges a font can hold.
+    ///
+    /// Glyphs that are not part of the ranges given to Load are rasterized the
+    /// first time they are drawn or measured and placed into a reserved area
+    /// of the atlas. Once this area is full, the least recently used glyph is
+    /// replaced. Glyphs drawn during the current frame are never replaced, the
+    /// area is grown instead. A capacity of zero disables this, drawing missing
+    /// glyphs instead. Only affects fonts loaded after this is set.
+    ///
+    /// @param Capacity Number of glyphs to reserve space for.
+    static void SetGlyphCapacity(int Capacity);
+    static int GlyphCapacity();
+
+    /// @brief Sets the directory used to cache baked font atlases.
+    ///
+    /// When set, the atlas pixels and glyph metrics of each loaded font are
+    /// written to this directory. Later loads of the same font file, size and
+    /// ranges map the cached file instead of baking the atlas again. An empty
+    /// directory disables the cache, which is the default.
+    ///
+    /// @param Directory Path to the cache directory. Created if it does not exist.
+    static void SetCacheDirectory(const char* Directory);
+    static const char* CacheDirectory();
+
+    /// @brief Marks the end of a frame.
+    ///
+    /// Dynamic glyphs drawn since the last call may have quads waiting to be
+    /// rendered, so they can only be replaced once this is called. Textures that
+    /// were replaced by a grown atlas during the frame are unloaded here.
+    static void NextFrame();
+
     Font();
     ~Font();
 
-    bool Load(const char* Path, float Size, const std::vector<Range>& Ranges);
-    bool Draw(uint32_t Char, Vector2& Position, Rect& Vertices, Rect& TexCoords) const;
+    bool Load(const char* Path, float Size, const std::vector<Range>& Ranges, bool DistanceField = false);
+
+    /// @brief Rasterizes the glyph atlas without creating the texture.
+    ///
+    /// Only touches this font's data, so fonts can be baked on worker threads.
+    /// Upload must be called on the main thread before the font is used.
+    bool Bake(const char* Path, float Size, const std::vector<Range>& Ranges, bool DistanceField = false);
+
+    /// @brief Creates the texture from the atlas produced by Bake.
+    bool Upload();
+
+    /// @brief Positions a glyph and advances the position past it.
+    ///
+    /// @param Cells If given, the cell of a dynamic glyph is added to this list so the glyph
+    /// can be marked as drawn with UseCells when its quad is drawn again without calling this.
+    bool Draw(uint32_t Char, Vector2& Position, Rect& Vertices, Rect& TexCoords, std::vector<uint32_t>* Cells = nullptr) const;
     Vector2 Measure(const std::u32string_view& Text) const;
     Vector2 Measure(const std::u32string_view& Text, int& Lines) const;
     Vector2 Measure(const std::u32string_view& Text, int& Lines, float Wrap) const;
@@ -91,20 +140,80 @@ public:
     const char* Path() const;
     const std::shared_ptr<Texture>& GetTexture() const;
 
-private:
-    typedef std::unordered_map<unsigned int, Glyph> GlyphMap;
+    /// @brief Number of glyphs rasterized after the font was loaded.
+    uint32_t DynamicGlyphCount() const;
 
-    const Glyph& GetGlyph(uint32_t CodePoint) const;
+    /// @brief Incremented each time a dynamic glyph is replaced by another one or
+    /// the atlas is grown to fit more of them.
+    ///
+    /// Glyph coordinates gathered before this changes may point to the wrong
+    /// glyph and need to be gathered again.
+    uint32_t GlyphRevision() const;
 
-    static int s_TabSize;
+    /// @brief Marks the glyphs in the given cells as drawn this frame so they are not replaced.
+    void UseCells(const std::vector<uint32_t>& Cells) const;
 
-    GlyphMap m_Glyphs;
+    bool DistanceField() const;
+
+private:
+    uint32_t GlyphIndex(uint32_t CodePoint) const;
+    uint32_t LoadGlyph(uint32_t CodePoint) const;
+    void SetGlyphIndex(uint32_t CodePoint, uint32_t Index) const;
+    void RemoveGlyphIndex(uint32_t CodePoint) const;
+    bool GrowCells() const;
+    void ReserveCells(uint32_t Capacity, Vector2& TextureSize);
+    void SetAtlas(const uint8_t* Alpha, uint32_t Width, uint32_t Height);
+    uint64_t CacheKey(const std::vector<Range>& Ranges, uint32_t Capacity) const;
+    bool ReadCache(const std::string& Path, uint64_t Key, uint32_t Capacity);
+    void WriteCache(const std::string& Path, uint64_t Key, const std::vector<uint8_t>& Alpha, uint32_t Width, uint32_t Height) const;
+
+    static int s_TabSize;
+    static int s_GlyphCapacity;
+    static std::string s_CacheDirectory;
+    static uint64_t s_Frame;
+    static std::vector<std::shared_ptr<Texture>> s_Retired;
+
+    // Glyph metrics are stored as parallel arrays indexed by a glyph index. Code points below
+    // a limit map directly to their index through a dense table while any others are found
+    // through a sorted list.
+    // Glyphs loaded on demand are mutable as they are added while drawing or measuring.
+    mutable std::vector<Vector2> m_GlyphOffsets {};
+    mutable std::vector<Vector2> m_GlyphSizes {};
+    mutable std::vector<float> m_GlyphAdvances {};
+    mutable std::vector<Rect> m_GlyphUVs {};
+    mutable std::vector<uint32_t> m_DenseGlyphs {};
+    mutable std::vector<std::pair<uint32_t, uint32_t>> m_SparseGlyphs {};
+    uint32_t m_MissingGlyph { 0 };
+
+    // Glyphs outside of the loaded ranges are placed into fixed size cells at the bottom of
+    // the atlas. The glyph index of a cell is m_DynamicGlyphs plus the cell index.
+    MappedFile m_FontFile {};
+    std::unique_ptr<stbtt_fontinfo> m_Info { nullptr };
+    float m_Scale { 0.0f };
+    uint32_t m_DynamicGlyphs { 0 };
+    Vector2 m_CellOrigin {};
+    Vector2 m_CellSize {};
+    uint32_t m_CellColumns { 0 };
+    mutable std::vector<uint32_t> m_CellCodePoints {};
+    mutable std::vector<uint64_t> m_CellLastUsed {};
+    mutable std::vector<uint64_t> m_CellFrames {};
+    mutable uint64_t m_GlyphClock { 0 };
+    mutable uint32_t m_GlyphRevision { 0 };
+    bool m_DistanceField { false };
+    std::shared_ptr<Font> m_Source { nullptr };
+    float m_GlyphScale { 1.0f };
     float m_Size { 0.0f };
     float m_Ascent { 0.0f };
     float m_Descent { 0.0f };
     Vector2 m_SpaceSize {};
-    std::shared_ptr<Texture> m_Texture { nullptr };
+    mutable std::shared_ptr<Texture> m_Texture { nullptr };
     std::string m_Path {};
+
+    // RGBA pixels of the baked atlas, released once uploaded. Fonts with dynamic glyphs keep
+    // them to create a taller texture when all of the cells are in use.
+    mutable std::vector<uint8_t> m_Atlas {};
+    uint32_t m_AtlasWidth { 0 };
+    mutable uint32_t m_AtlasHeight { 0 };
 };
 
 }
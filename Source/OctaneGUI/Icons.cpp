@@ -26,8 +26,10 @@ SOFTWARE.
 
 #include "Icons.h"
 #include "Color.h"
+#include "TaskPool.h"
 #include "Texture.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace OctaneGUI
@@ -148,7 +150,7 @@ void Icons::Initialize()
         }
     }
 
-    m_Texture = Texture::Load(Buffer, Width, Height);
+    m_Texture = Texture::LoadShared(Buffer, Width, Height);
 
     m_UVs[(int)Type::ArrowRight] = { 0.0f, 0.0f, 16.0f, 16.0f };
     m_UVs[(int)Type::ArrowLeft] = { 16.0f, 0.0f, 32.0f, 16.0f };
@@ -166,28 +168,53 @@ void Icons::Initialize()
 }
 
 void Icons::Initialize(const std::vector<Definition>& Definitions, const Vector2& IconSize)
+{
+    TaskPool Pool;
+    Initialize(Definitions, IconSize, Pool);
+    Pool.Wait();
+    Upload();
+}
+
+void Icons::Initialize(const std::vector<Definition>& Definitions, const Vector2& IconSize, TaskPool& Pool)
 {
     const size_t IconW = (size_t)IconSize.X;
     const size_t IconH = (size_t)IconSize.Y;
-    const size_t Width = IconW;
-    const size_t Height = IconH * (size_t)Type::Max;
-    std::vector<uint8_t> Data;
-    Data.resize(Width * Height * 4);
+    const size_t IconBytes = IconW * IconH * 4;
+    m_Width = (uint32_t)IconW;
+    m_Height = (uint32_t)(IconH * (size_t)Type::Max);
+    m_Pixels.assign((size_t)m_Width * m_Height * 4, 0);
 
-    size_t DataOffset = 0;
+    // Each icon is rasterized into its own row of the atlas, so the tasks never write to the same pixels.
     Vector2 Offset;
-    for (const Definition& Item : Definitions)
+    for (size_t I = 0; I < Definitions.size() && I < (size_t)Type::Max; I++)
     {
-        const std::vector<uint8_t> IconData = Texture::LoadSVGData(Item.FileName.c_str(), IconW, IconH);
-        memcpy(&Data[DataOffset], IconData.data(), IconData.size());
-        DataOffset += IconData.size();
+        const Definition& Item = Definitions[I];
+        uint8_t* Destination = &m_Pixels[I * IconBytes];
+        Pool.Add([Destination, IconBytes, IconW, IconH, FileName = Item.FileName]() -> void
+            {
+                const std::vector<uint8_t> IconData = Texture::LoadSVGData(FileName.c_str(), (uint32_t)IconW, (uint32_t)IconH);
+                memcpy(Destination, IconData.data(), std::min<size_t>(IconData.size(), IconBytes));
+            });
 
         Type IconType = ToType(Item.Name);
-        m_UVs[(int)IconType] = { Offset.X, Offset.Y, Offset.X + IconSize.X, Offset.Y + IconSize.Y };
+        if (IconType != Type::Max)
+        {
+            m_UVs[(int)IconType] = { Offset.X, Offset.Y, Offset.X + IconSize.X, Offset.Y + IconSize.Y };
+        }
         Offset.Y += IconSize.Y;
     }
+}
+
+void Icons::Upload()
+{
+    if (m_Pixels.empty())
+    {
+        return;
+    }
 
-    m_Texture = Texture::Load(Data, Width, Height);
+    m_Texture = Texture::LoadShared(m_Pixels, m_Width, m_Height);
+    m_Pixels.clear();
+    m_Pixels.shrink_to_fit();
 }
 
 std::shared_ptr<Texture> Icons::GetTexture() const
@@ -202,11 +229,7 @@ Rect Icons::GetUVs(Type InType) const
 
 Rect Icons::GetUVsNormalized(Type InType) const
 {
-    const Rect& UVs = m_UVs[(int)InType];
-    const Vector2 Size = m_Texture->GetSize();
-    return Rect(
-        UVs.Min / Size,
-        UVs.Max / Size);
+    return m_Texture->Normalize(m_UVs[(int)InType]);
 }
 
 }
@@ -36,6 +36,7 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+class TaskPool;
 class Texture;
 
 class Icons
@@ -74,6 +75,14 @@ public:
 
     void Initialize();
     void Initialize(const std::vector<Definition>& Definitions, const Vector2& IconSize);
+
+    /// @brief Rasterizes the given icons on the pool's workers.
+    ///
+    /// Upload must be called on the main thread after the pool has finished
+    /// to create the texture.
+    void Initialize(const std::vector<Definition>& Definitions, const Vector2& IconSize, TaskPool& Pool);
+    void Upload();
+
     std::shared_ptr<Texture> GetTexture() const;
     Rect GetUVs(Type InType) const;
     Rect GetUVsNormalized(Type InType) const;
@@ -81,6 +90,10 @@ public:
 private:
     std::shared_ptr<Texture> m_Texture;
     Rect m_UVs[(uint32_t)Type::Max];
+
+    std::vector<uint8_t> m_Pixels {};
+    uint32_t m_Width { 0 };
+    uint32_t m_Height { 0 };
 };
 
 }
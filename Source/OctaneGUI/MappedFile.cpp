@@ -0,0 +1,148 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "MappedFile.h"
+#include "Defines.h"
+
+#if defined(WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace OctaneGUI
+{
+
+MappedFile::MappedFile()
+{
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const char* Path)
+{
+    Close();
+
+#if defined(WINDOWS)
+    HANDLE File = CreateFileA(Path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER FileSize {};
+    if (!GetFileSizeEx(File, &FileSize) || FileSize.QuadPart == 0)
+    {
+        CloseHandle(File);
+        return false;
+    }
+
+    // The view keeps the mapping alive so both handles can be closed once it is created.
+    HANDLE Mapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(File);
+    if (Mapping == nullptr)
+    {
+        return false;
+    }
+
+    void* View = MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(Mapping);
+    if (View == nullptr)
+    {
+        return false;
+    }
+
+    m_Data = static_cast<const uint8_t*>(View);
+    m_Size = (size_t)FileSize.QuadPart;
+#else
+    const int File = open(Path, O_RDONLY);
+    if (File < 0)
+    {
+        return false;
+    }
+
+    struct stat Stat {};
+    if (fstat(File, &Stat) != 0 || Stat.st_size == 0)
+    {
+        close(File);
+        return false;
+    }
+
+    // The mapping stays valid after the file descriptor is closed.
+    void* View = mmap(nullptr, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, File, 0);
+    close(File);
+    if (View == MAP_FAILED)
+    {
+        return false;
+    }
+
+    m_Data = static_cast<const uint8_t*>(View);
+    m_Size = (size_t)Stat.st_size;
+#endif
+
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_Data == nullptr)
+    {
+        return;
+    }
+
+#if defined(WINDOWS)
+    UnmapViewOfFile(m_Data);
+#else
+    munmap(const_cast<uint8_t*>(m_Data), m_Size);
+#endif
+
+    m_Data = nullptr;
+    m_Size = 0;
+}
+
+bool MappedFile::IsOpen() const
+{
+    return m_Data != nullptr;
+}
+
+const uint8_t* MappedFile::Data() const
+{
+    return m_Data;
+}
+
+size_t MappedFile::Size() const
+{
+    return m_Size;
+}
+
+}
@@ -66,6 +66,7 @@ SOFTWARE.
 #include "Dialogs/FileDialog.h"
 #include "DrawCommand.h"
 #include "Event.h"
+#include "EventScript.h"
 #include "FileSystem.h"
 #include "FlyString.h"
 #include "Font.h"
@@ -75,6 +76,9 @@ SOFTWARE.
 #include "Paint.h"
 #include "Rect.h"
 #include "String.h"
+#include "TaskPool.h"
+#include "TextLayout.h"
+#include "Texture.h"
 #include "Theme.h"
 #include "Timer.h"
 #include "Variant.h"
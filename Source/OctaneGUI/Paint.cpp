@@ -28,65 +28,132 @@ SOFTWARE.
 #include "Application.h"
 #include "Font.h"
 #include "Rect.h"
+#include "TextLayout.h"
 #include "TextSpan.h"
 #include "Texture.h"
 #include "Theme.h"
 
+#include <algorithm>
 #include <cmath>
 
 #define PI 3.14159265358979323846f
 
-#define RECT_INDEX_COUNT(Count) Count * 6
-#define CIRCLE_INDEX_COUNT(Steps) Steps * 3
+#define RECT_INDEX_COUNT(Count) ((Count) * 6)
+#define CIRCLE_INDEX_COUNT(Steps) ((Steps) * 3)
+
+// Maximum distance in pixels between a tessellated arc and the true curve. Feathered edges
+// hide more of the error, so fewer steps are needed for them.
+#define ARC_TOLERANCE 0.25f
+#define FEATHERED_ARC_TOLERANCE 0.5f
+#define ARC_MAX_STEPS 64
+
+// Width in pixels of the fringe that fades a feathered edge to transparent.
+#define FEATHER_WIDTH 1.0f
+#define FEATHERED_LINE_INDEX_COUNT 18
+#define FEATHERED_FAN_INDEX_COUNT(Edges) ((Edges) * 9)
+#define FEATHERED_ARC_INDEX_COUNT(Steps) ((Steps) * 18)
 
 namespace OctaneGUI
 {
 
-std::vector<Vector2> GetArcPoints(const Vector2& Center, float Radius, float StartAngle, float EndAngle, int Steps)
+// Returns the points of a unit circle split into the given number of steps. The last point is the
+// first point again. One table is computed for each step count and reused by every draw after that.
+const std::vector<Vector2>& GetUnitCircle(int Steps)
 {
-    const float Rad = PI / 180;
-    const float Delta = Rad * (EndAngle - StartAngle);
-    const float Start = Rad * StartAngle;
+    static std::vector<Vector2> Tables[ARC_MAX_STEPS + 1];
 
-    std::vector<Vector2> Result;
-    Result.resize(Steps + 1);
-
-    for (int I = 0; I <= Steps; I++)
+    std::vector<Vector2>& Result = Tables[Steps];
+    if (Result.empty())
     {
-        const float Pct = ((float)I / (float)(Steps - 1));
-        const float Angle = Pct * Delta + Start;
-        const Vector2 Point { std::roundf(std::cos(Angle) * Radius), std::roundf(std::sin(Angle) * Radius) };
-        Result[I] = Center + Point;
+        Result.resize(Steps + 1);
+        for (int I = 0; I <= Steps; I++)
+        {
+            const float Angle = ((float)I / (float)Steps) * 2.0f * PI;
+            Result[I] = { std::cos(Angle), std::sin(Angle) };
+        }
     }
 
     return Result;
 }
 
-std::vector<Vector2> GetCirclePoints(const Vector2& Center, float Radius, int Steps)
+// Returns the point of the unit circle at the given angle, which is taken from the table when
+// the angle falls on one of its steps.
+Vector2 GetUnitPoint(const std::vector<Vector2>& Circle, float Angle)
 {
-    const float Delta = (2.0f * PI) / Steps;
+    const int Steps = (int)Circle.size() - 1;
+    const float Step = Angle * Steps / 360.0f;
+    const float Nearest = std::round(Step);
+    if (std::abs(Step - Nearest) < 1e-3f)
+    {
+        const int Index = (int)Nearest % Steps;
+        return Circle[Index < 0 ? Index + Steps : Index];
+    }
 
-    std::vector<Vector2> Result;
-    Result.resize(Steps + 1);
+    const float Rad = Angle * PI / 180.0f;
+    return { std::cos(Rad), std::sin(Rad) };
+}
+
+// Gathers the points on a unit circle from the start angle to the end angle, inclusive. The points
+// between the two angles are the ones of the table for the given step count.
+const std::vector<Vector2>& GetUnitArc(float StartAngle, float EndAngle, int Steps, std::vector<Vector2>& Points)
+{
+    const std::vector<Vector2>& Circle = GetUnitCircle(Steps);
+    const float Start = StartAngle * Steps / 360.0f;
+    const float End = EndAngle * Steps / 360.0f;
 
-    for (int I = 0; I <= Steps; I++)
+    Points.clear();
+    Points.push_back(GetUnitPoint(Circle, StartAngle));
+    if (End >= Start)
     {
-        const float Angle = I * Delta;
-        Result[I] = { Center.X + std::roundf(std::cos(Angle) * Radius), Center.Y + std::roundf(std::sin(Angle) * Radius) };
+        for (int I = (int)std::floor(Start + 1e-3f) + 1; I < End - 1e-3f; I++)
+        {
+            Points.push_back(Circle[((I % Steps) + Steps) % Steps]);
+        }
     }
+    else
+    {
+        for (int I = (int)std::ceil(Start - 1e-3f) - 1; I > End + 1e-3f; I--)
+        {
+            Points.push_back(Circle[((I % Steps) + Steps) % Steps]);
+        }
+    }
+    Points.push_back(GetUnitPoint(Circle, EndAngle));
 
-    return Result;
+    return Points;
 }
 
-Paint::Paint()
-    : m_Buffer()
-    , m_Theme(nullptr)
+// Picks enough steps for a full circle so that no segment strays more than the tolerance in pixels
+// from the curve. The count is a multiple of four so that each quarter of the circle starts on a step.
+int GetArcSteps(float Radius, float Tolerance)
 {
+    if (Radius <= Tolerance)
+    {
+        return 4;
+    }
+
+    const float Segment = 2.0f * std::acos(1.0f - Tolerance / Radius);
+    const int Steps = (int)std::ceil(2.0f * PI / Segment);
+    return std::clamp<int>((Steps + 3) / 4 * 4, 4, ARC_MAX_STEPS);
 }
 
-Paint::Paint(const std::shared_ptr<Theme>& InTheme)
+// An arc of a unit circle placed at a center and scaled to a radius. The unit points double
+// as the normals of the edge, which is what a feathered edge is offset along.
+struct Paint::ArcSpan
+{
+public:
+    Vector2 Center {};
+    float Radius { 0.0f };
+    const std::vector<Vector2>* Points { nullptr };
+};
+
+Paint::Paint(VertexBuffer& Buffer, const std::shared_ptr<Theme>& InTheme)
     : m_Theme(InTheme)
+    , m_Buffer(Buffer)
 {
+    if (m_Theme)
+    {
+        m_AntiAliased = m_Theme->Get(ThemeProperties::AntiAliasing).Bool();
+    }
 }
 
 Paint::~Paint()
@@ -95,6 +162,13 @@ Paint::~Paint()
 
 void Paint::Line(const Vector2& Start, const Vector2& End, const Color& Col, float Thickness)
 {
+    if (m_AntiAliased)
+    {
+        PushCommand(FEATHERED_LINE_INDEX_COUNT, 0);
+        AddFeatheredLine(Start, End, Col, Thickness);
+        return;
+    }
+
     PushCommand(6, 0);
     AddLine(Start, End, Col, Thickness);
 }
@@ -171,14 +245,35 @@ void Paint::RectangleRounded(const Rect& Bounds, const Color& Col, const Rect& R
     const float RadiusBL = Radius.Max.X;
     const float RadiusBR = Radius.Max.Y;
 
-    size_t Offset = 0;
+    const std::vector<Vector2>& PointsTL = GetUnitArc(180.0f, 270.0f, ArcSteps(RadiusTL), m_Arcs[0]);
+    const std::vector<Vector2>& PointsTR = GetUnitArc(270.0f, 360.0f, ArcSteps(RadiusTR), m_Arcs[1]);
+    const std::vector<Vector2>& PointsBR = GetUnitArc(0.0f, 90.0f, ArcSteps(RadiusBR), m_Arcs[2]);
+    const std::vector<Vector2>& PointsBL = GetUnitArc(90.0f, 180.0f, ArcSteps(RadiusBL), m_Arcs[3]);
+    const int Steps = (int)(PointsTL.size() + PointsTR.size() + PointsBR.size() + PointsBL.size()) - 4;
+
+    if (m_AntiAliased)
+    {
+        // The corners joined together form the outline of a convex shape, so it can be filled
+        // with a single fan. The straight edges run between the ends of neighboring corners.
+        const ArcSpan Corners[4] {
+            { { Left + RadiusTL, Top + RadiusTL }, RadiusTL, &PointsTL },
+            { { Right - RadiusTR, Top + RadiusTR }, RadiusTR, &PointsTR },
+            { { Right - RadiusBR, Bottom - RadiusBR }, RadiusBR, &PointsBR },
+            { { Left + RadiusBL, Bottom - RadiusBL }, RadiusBL, &PointsBL }
+        };
+
+        PushCommand(FEATHERED_FAN_INDEX_COUNT(Steps + 4), 0);
+        AddFeatheredFan(Bounds.Min + Bounds.GetSize() * 0.5f, Corners, 4, true, Col);
+        return;
+    }
+
+    uint32_t Offset = 0;
 
     Vector2 Min {};
     Vector2 Max {};
 
     // 5 Rectangles and 4 arcs.
-    const int Steps = 32;
-    uint32_t IndexCount = RECT_INDEX_COUNT(5) + CIRCLE_INDEX_COUNT(Steps) * 4;
+    uint32_t IndexCount = RECT_INDEX_COUNT(5) + CIRCLE_INDEX_COUNT(Steps);
     PushCommand(IndexCount, 0);
 
     // Left Rectangle
@@ -211,25 +306,11 @@ void Paint::RectangleRounded(const Rect& Bounds, const Color& Col, const Rect& R
     AddTriangles({ Min, Max }, Col, Offset);
     Offset += 4;
 
-    Vector2 Center { Left + RadiusTL, Top + RadiusTL };
-    std::vector<Vector2> Vertices = GetArcPoints(Center, RadiusTL, 180.0f, 270.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
-
-    Center = { Right - RadiusTR, Top + RadiusTR };
-    Vertices = GetArcPoints(Center, RadiusTR, 270.0f, 360.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
-
-    Center = { Right - RadiusBR, Bottom - RadiusBR };
-    Vertices = GetArcPoints(Center, RadiusBR, 0.0f, 90.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
-
-    Center = { Left + RadiusBL, Bottom - RadiusBL };
-    Vertices = GetArcPoints(Center, RadiusBL, 90.0f, 180.0f, Steps);
-    AddTrianglesCircle(Center, Vertices, Col, Offset);
-    Offset += Steps;
+    // Each arc adds its center and one more point than it has steps.
+    Offset += AddTrianglesArc({ Left + RadiusTL, Top + RadiusTL }, RadiusTL, PointsTL, Col, Offset);
+    Offset += AddTrianglesArc({ Right - RadiusTR, Top + RadiusTR }, RadiusTR, PointsTR, Col, Offset);
+    Offset += AddTrianglesArc({ Right - RadiusBR, Bottom - RadiusBR }, RadiusBR, PointsBR, Col, Offset);
+    AddTrianglesArc({ Left + RadiusBL, Bottom - RadiusBL }, RadiusBL, PointsBL, Col, Offset);
 }
 
 void Paint::Text(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const Color& Col)
@@ -259,16 +340,31 @@ void Paint::Textf(const std::shared_ptr<Font>& InFont, const Vector2& Position,
     std::vector<Rect> GlyphRects;
     std::vector<Rect> GlyphUVs;
     std::vector<Color> GlyphColors;
-    Vector2 Pos = Position;
-    for (size_t I = 0; I < Spans.size(); I++)
+    std::vector<uint32_t> Cells;
+    uint32_t Revision = 0;
+
+    // A glyph that grows the font's atlas moves the glyphs gathered before it, so they are
+    // gathered again until no glyph changes.
+    do
     {
-        const TextSpan& Span = Spans[I];
-        const std::u32string_view& View = Views[I];
-        int Count = GatherGlyphs(InFont, Pos, Position, View, GlyphRects, GlyphUVs);
-        GlyphColors.insert(GlyphColors.end(), Count, Span.TextColor);
-    }
+        Revision = InFont->GlyphRevision();
+        GlyphRects.clear();
+        GlyphUVs.clear();
+        GlyphColors.clear();
+        Cells.clear();
+
+        Vector2 Pos = Position;
+        for (size_t I = 0; I < Spans.size(); I++)
+        {
+            const TextSpan& Span = Spans[I];
+            const std::u32string_view& View = Views[I];
+            int Count = GatherGlyphs(InFont, Pos, Position, View, GlyphRects, GlyphUVs, m_Fonts != nullptr ? &Cells : nullptr);
+            GlyphColors.insert(GlyphColors.end(), Count, Span.TextColor);
+        }
+    } while (Revision != InFont->GlyphRevision());
 
-    AddTriangles(GlyphRects, GlyphUVs, GlyphColors, InFont->ID());
+    RecordFont(InFont, Revision, Cells);
+    AddTriangles(GlyphRects, GlyphUVs, GlyphColors, InFont->ID(), InFont->DistanceField());
 }
 
 void Paint::TextWrapped(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const std::vector<TextSpan>& Spans, float Width)
@@ -278,48 +374,73 @@ void Paint::TextWrapped(const std::shared_ptr<Font>& InFont, const Vector2& Posi
         return;
     }
 
-    std::vector<Rect> GlyphRects;
-    std::vector<Rect> GlyphUVs;
-    std::vector<Color> GlyphColors;
+    // Controls that draw the same wrapped text every frame should keep their own layout instead.
+    TextLayout Layout;
+    Layout.Update(InFont, Contents, 0, Width);
+    Text(Layout, Position, Spans);
+}
 
-    size_t Start = 0;
-    Vector2 Pos = Position;
-    for (const TextSpan& Span : Spans)
+void Paint::Text(const TextLayout& Layout, const Vector2& Position, const std::vector<TextSpan>& Spans)
+{
+    const std::shared_ptr<Font>& InFont = Layout.GetFont();
+    const std::vector<TextLayout::Line>& Lines = Layout.Lines();
+    if (!InFont || Lines.empty())
+    {
+        return;
+    }
+
+    const std::vector<Rect>& Rects = Layout.Rects();
+    const std::vector<Rect>& UVs = Layout.UVs();
+    const std::vector<uint32_t>& Indices = Layout.Indices();
+
+    // Lines are stacked at the font's size, so the visible lines can be found without looking at any glyphs.
+    size_t FirstGlyph = 0;
+    size_t LastGlyph = Rects.size();
+    if (!m_ClipStack.empty() && !m_ClipStack.back().IsZero())
     {
-        std::vector<std::u32string_view> Views;
-        Start = Span.Start;
-        for (size_t Index = Span.Start; Index < Span.End; Index++)
+        const Rect& Clip = m_ClipStack.back();
+        const float LineHeight = InFont->Size();
+        const float FirstLine = std::floor((Clip.Min.Y - Position.Y) / LineHeight);
+        const float LastLine = std::floor((Clip.Max.Y - Position.Y) / LineHeight) + 1.0f;
+
+        if (LastLine <= 0.0f || FirstLine >= (float)Lines.size())
         {
-            const char32_t& Char = Contents[Index];
-            if (std::isspace(Char) || Index == Span.End - 1)
-            {
-                Index = std::min<size_t>(Index + 1, Span.End);
-                size_t Count = Index - Start;
-                const std::u32string_view View(&Contents[Start], Count);
-
-                std::vector<Rect> Rects;
-                std::vector<Rect> UVs;
-                int Added = GatherGlyphs(InFont, Pos, Position, View, Rects, UVs, false);
-                GlyphColors.insert(GlyphColors.end(), Added, Span.TextColor);
-
-                float CurrentWidth = Pos.X - Position.X;
-                if (CurrentWidth > Width)
-                {
-                    Rects.clear();
-                    UVs.clear();
-                    Pos.X = Position.X;
-                    Pos.Y += InFont->Size();
-                    GatherGlyphs(InFont, Pos, Position, View, Rects, UVs, false);
-                }
-
-                GlyphRects.insert(GlyphRects.end(), Rects.begin(), Rects.end());
-                GlyphUVs.insert(GlyphUVs.end(), UVs.begin(), UVs.end());
-                Start = Index;
-            }
+            return;
+        }
+
+        if (FirstLine > 0.0f)
+        {
+            FirstGlyph = Lines[(size_t)FirstLine].Glyph;
+        }
+
+        if (LastLine < (float)Lines.size())
+        {
+            LastGlyph = Lines[(size_t)LastLine].Glyph;
         }
     }
 
-    AddTriangles(GlyphRects, GlyphUVs, GlyphColors, InFont->ID());
+    // The glyphs are copied from the layout, so they are marked as drawn here instead of by the font.
+    InFont->UseCells(Layout.Cells());
+    RecordFont(InFont, Layout.GlyphRevision(), Layout.Cells());
+
+    const uint32_t TextureID = InFont->ID();
+    const bool DistanceField = InFont->DistanceField();
+    for (const TextSpan& Span : Spans)
+    {
+        // Glyph indices are increasing, so each span covers a contiguous range of glyphs.
+        const auto Begin = std::lower_bound(Indices.begin() + FirstGlyph, Indices.begin() + LastGlyph, (uint32_t)Span.Start);
+        const auto End = std::lower_bound(Begin, Indices.begin() + LastGlyph, (uint32_t)Span.End);
+        if (Begin == End)
+        {
+            continue;
+        }
+
+        const size_t Start = Begin - Indices.begin();
+        const size_t Count = End - Begin;
+
+        PushCommand(6 * (uint32_t)Count, TextureID, DistanceField);
+        m_Buffer.AddQuads(&Rects[Start], &UVs[Start], Span.TextColor, (uint32_t)Count, Position);
+    }
 }
 
 void Paint::Image(const Rect& Bounds, const Rect& TexCoords, const std::shared_ptr<Texture>& InTexture, const Color& Col)
@@ -335,50 +456,73 @@ void Paint::Image(const Rect& Bounds, const Rect& TexCoords, const std::shared_p
 
 void Paint::Circle(const Vector2& Center, float Radius, const Color& Tint, int Steps)
 {
-    std::vector<Vector2> Vertices = GetCirclePoints(Center, Radius, Steps);
+    Steps = Steps > 0 ? std::min<int>(Steps, ARC_MAX_STEPS) : ArcSteps(Radius);
+    const std::vector<Vector2>& Points = GetUnitCircle(Steps);
 
-    PushCommand(3 * Steps, 0);
-    AddTrianglesCircle(Center, Vertices, Tint, 0);
+    if (m_AntiAliased)
+    {
+        // The last point of the table is the first point again, so the fan is already closed.
+        const ArcSpan Span { Center, Radius, &Points };
+        PushCommand(FEATHERED_FAN_INDEX_COUNT(Steps), 0);
+        AddFeatheredFan(Center, &Span, 1, false, Tint);
+        return;
+    }
+
+    PushCommand(CIRCLE_INDEX_COUNT(Steps), 0);
+    AddTrianglesArc(Center, Radius, Points, Tint);
 }
 
 void Paint::CircleOutline(const Vector2& Center, float Radius, const Color& Tint, float Thickness, int Steps)
 {
-    std::vector<Vector2> Vertices = GetCirclePoints(Center, Radius, Steps);
+    Steps = Steps > 0 ? std::min<int>(Steps, ARC_MAX_STEPS) : ArcSteps(Radius);
+    const std::vector<Vector2>& Points = GetUnitCircle(Steps);
 
-    Vector2 Start = Vertices[0];
-    for (size_t I = 1; I < Vertices.size(); I++)
+    if (m_AntiAliased)
     {
-        const Vector2& End = Vertices[I];
-        Line(Start, End, Tint, Thickness);
-        Start = End;
+        PushCommand(FEATHERED_ARC_INDEX_COUNT(Steps), 0);
+        AddFeatheredArc(Center, Radius, Points, Tint, Thickness);
+        return;
     }
 
-    Line(Start, Vertices.front(), Tint, Thickness);
+    // The last point of the table is the first point again, which closes the outline.
+    PushCommand(RECT_INDEX_COUNT(Steps), 0);
+    AddLinesArc(Center, Radius, Points, Tint, Thickness);
 }
 
 void Paint::Arc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, int Steps)
 {
-    std::vector<Vector2> Vertices = GetArcPoints(Center, Radius, StartAngle, EndAngle, Steps);
+    Steps = Steps > 0 ? std::min<int>(Steps, ARC_MAX_STEPS) : ArcSteps(Radius);
+    const std::vector<Vector2>& Points = GetUnitArc(StartAngle, EndAngle, Steps, m_Arcs[0]);
+    Steps = (int)Points.size() - 1;
+
+    if (m_AntiAliased)
+    {
+        // Only the curved edge is feathered. The straight edges to the center are left as is.
+        const ArcSpan Span { Center, Radius, &Points };
+        PushCommand(FEATHERED_FAN_INDEX_COUNT(Steps), 0);
+        AddFeatheredFan(Center, &Span, 1, false, Tint);
+        return;
+    }
 
-    PushCommand(3 * Steps, 0);
-    AddTrianglesCircle(Center, Vertices, Tint);
+    PushCommand(CIRCLE_INDEX_COUNT(Steps), 0);
+    AddTrianglesArc(Center, Radius, Points, Tint);
 }
 
 void Paint::ArcOutline(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, float Thickness, int Steps)
 {
-    std::vector<Vector2> Vertices = GetArcPoints(Center, Radius, StartAngle, EndAngle, Steps);
-    if (Vertices.empty())
+    Steps = Steps > 0 ? std::min<int>(Steps, ARC_MAX_STEPS) : ArcSteps(Radius);
+    const std::vector<Vector2>& Points = GetUnitArc(StartAngle, EndAngle, Steps, m_Arcs[0]);
+    Steps = (int)Points.size() - 1;
+
+    if (m_AntiAliased)
     {
+        PushCommand(FEATHERED_ARC_INDEX_COUNT(Steps), 0);
+        AddFeatheredArc(Center, Radius, Points, Tint, Thickness);
         return;
     }
 
-    Vector2 Start = Vertices[0];
-    for (size_t I = 1; I < Vertices.size(); I++)
-    {
-        const Vector2& End = Vertices[I];
-        Line(Start, End, Tint, Thickness);
-        Start = End;
-    }
+    PushCommand(RECT_INDEX_COUNT(Steps), 0);
+    AddLinesArc(Center, Radius, Points, Tint, Thickness);
 }
 
 void Paint::PushClip(const Rect& Bounds)
@@ -410,6 +554,116 @@ bool Paint::IsClipped(const Rect& Bounds) const
     return !(Clip.Intersects(Bounds) || Clip.Encompasses(Bounds));
 }
 
+Rect Paint::CurrentClip() const
+{
+    if (m_ClipStack.empty())
+    {
+        return Rect();
+    }
+
+    return m_ClipStack.back();
+}
+
+Paint& Paint::SetDamage(const std::vector<Rect>& Damage)
+{
+    m_Damage = Damage;
+    return *this;
+}
+
+const std::vector<Rect>& Paint::Damage() const
+{
+    return m_Damage;
+}
+
+bool Paint::IsDamaged(const Rect& Bounds) const
+{
+    if (m_Damage.empty() || m_DamageSuspended > 0)
+    {
+        return true;
+    }
+
+    for (const Rect& Region : m_Damage)
+    {
+        if (Region.Intersects(Bounds))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Paint& Paint::SuspendDamage(bool Suspend)
+{
+    m_DamageSuspended += Suspend ? 1 : -1;
+    return *this;
+}
+
+void Paint::Replay(const VertexBuffer& Source)
+{
+    m_Buffer.Append(Source);
+}
+
+std::vector<Paint::FontRecord>* Paint::BeginRecordFonts(std::vector<FontRecord>& Fonts)
+{
+    std::vector<FontRecord>* Previous = m_Fonts;
+    m_Fonts = &Fonts;
+    return Previous;
+}
+
+void Paint::EndRecordFonts(std::vector<FontRecord>* Previous)
+{
+    std::vector<FontRecord>* Fonts = m_Fonts;
+    m_Fonts = Previous;
+
+    if (Fonts == nullptr)
+    {
+        return;
+    }
+
+    for (FontRecord& Record : *Fonts)
+    {
+        std::sort(Record.Cells.begin(), Record.Cells.end());
+        Record.Cells.erase(std::unique(Record.Cells.begin(), Record.Cells.end()), Record.Cells.end());
+        RecordFont(Record.Source, Record.Revision, Record.Cells);
+    }
+}
+
+bool Paint::UseFonts(const std::vector<FontRecord>& Fonts)
+{
+    for (const FontRecord& Record : Fonts)
+    {
+        if (Record.Source->GlyphRevision() != Record.Revision)
+        {
+            return false;
+        }
+    }
+
+    for (const FontRecord& Record : Fonts)
+    {
+        Record.Source->UseCells(Record.Cells);
+        RecordFont(Record.Source, Record.Revision, Record.Cells);
+    }
+
+    return true;
+}
+
+void Paint::BreakBatch()
+{
+    m_Buffer.BreakBatch();
+}
+
+Paint& Paint::SetAntiAliased(bool AntiAliased)
+{
+    m_AntiAliased = AntiAliased;
+    return *this;
+}
+
+bool Paint::AntiAliased() const
+{
+    return m_AntiAliased;
+}
+
 const VertexBuffer& Paint::GetBuffer() const
 {
     return m_Buffer;
@@ -453,39 +707,157 @@ void Paint::AddTriangles(const Rect& Vertices, const Rect& TexCoords, const Colo
     AddTriangleIndices(Offset);
 }
 
-void Paint::AddTriangles(const std::vector<Rect>& Rects, const std::vector<Rect>& UVs, const std::vector<Color>& Colors, uint32_t TextureID)
+void Paint::AddTriangles(const std::vector<Rect>& Rects, const std::vector<Rect>& UVs, const std::vector<Color>& Colors, uint32_t TextureID, bool DistanceField)
 {
     if (Rects.empty() || UVs.empty() || Colors.empty())
     {
         return;
     }
 
-    PushCommand(6 * Rects.size(), TextureID);
+    PushCommand(6 * Rects.size(), TextureID, DistanceField);
+    m_Buffer.AddQuads(Rects.data(), UVs.data(), Colors.data(), (uint32_t)Rects.size());
+}
 
-    uint32_t Offset = 0;
-    for (size_t I = 0; I < Rects.size(); I++)
+uint32_t Paint::AddTrianglesArc(const Vector2& Center, float Radius, const std::vector<Vector2>& Points, const Color& Tint, uint32_t Offset)
+{
+    m_Buffer.AddVertex(Center, Tint);
+    for (const Vector2& Point : Points)
+    {
+        m_Buffer.AddVertex({ Center.X + std::roundf(Point.X * Radius), Center.Y + std::roundf(Point.Y * Radius) }, Tint);
+    }
+
+    // The first vertex is the center, which every triangle shares.
+    for (uint32_t I = 0; I < (uint32_t)Points.size() - 1; I++)
+    {
+        m_Buffer.AddIndex(Offset);
+        m_Buffer.AddIndex(Offset + I + 1);
+        m_Buffer.AddIndex(Offset + I + 2);
+    }
+
+    return (uint32_t)Points.size() + 1;
+}
+
+void Paint::AddLinesArc(const Vector2& Center, float Radius, const std::vector<Vector2>& Points, const Color& Tint, float Thickness)
+{
+    Vector2 Start { Center.X + std::roundf(Points[0].X * Radius), Center.Y + std::roundf(Points[0].Y * Radius) };
+    for (size_t I = 1; I < Points.size(); I++)
+    {
+        const Vector2 End { Center.X + std::roundf(Points[I].X * Radius), Center.Y + std::roundf(Points[I].Y * Radius) };
+        AddLine(Start, End, Tint, Thickness, (uint32_t)(I - 1) * 4);
+        Start = End;
+    }
+}
+
+void Paint::AddFeatheredLine(const Vector2& Start, const Vector2& End, const Color& Col, float Thickness)
+{
+    const Vector2 Direction = (End - Start).Unit();
+    const Vector2 Normal { -Direction.Y, Direction.X };
+
+    // Lines thinner than the fringe are drawn at the fringe's width but fainter.
+    const float HalfCore = std::max<float>(Thickness - FEATHER_WIDTH, 0.0f) * 0.5f;
+    const float HalfWidth = HalfCore + FEATHER_WIDTH;
+    const Color Core(Col.R, Col.G, Col.B, (uint8_t)(Col.A * std::min<float>(Thickness / FEATHER_WIDTH, 1.0f)));
+    const Color Transparent(Col.R, Col.G, Col.B, 0);
+
+    // Four vertices across each end: transparent, core, core, transparent.
+    const Vector2 Points[2] { Start, End };
+    for (const Vector2& Point : Points)
     {
-        const Rect& Vertices = Rects[I];
-        const Rect& TexCoords = UVs[I];
-        const Color& Color_ = Colors[I];
+        m_Buffer.AddVertex(Point + Normal * HalfWidth, Transparent);
+        m_Buffer.AddVertex(Point + Normal * HalfCore, Core);
+        m_Buffer.AddVertex(Point - Normal * HalfCore, Core);
+        m_Buffer.AddVertex(Point - Normal * HalfWidth, Transparent);
+    }
 
-        AddTriangles(Vertices, TexCoords, Color_, Offset);
-        Offset += 4;
+    for (uint32_t I = 0; I < 3; I++)
+    {
+        m_Buffer.AddIndex(I);
+        m_Buffer.AddIndex(I + 1);
+        m_Buffer.AddIndex(I + 5);
+        m_Buffer.AddIndex(I);
+        m_Buffer.AddIndex(I + 5);
+        m_Buffer.AddIndex(I + 4);
     }
 }
 
-void Paint::AddTrianglesCircle(const Vector2& Center, const std::vector<Vector2>& Vertices, const Color& Tint, uint32_t Offset)
+uint32_t Paint::AddFeatheredFan(const Vector2& Center, const ArcSpan* Spans, int Count, bool Closed, const Color& Col, uint32_t Offset)
 {
-    m_Buffer.AddVertex(Center, Tint);
-    m_Buffer.AddVertices(Vertices, Tint);
+    const Color Transparent(Col.R, Col.G, Col.B, 0);
+    const float Half = FEATHER_WIDTH * 0.5f;
 
-    // We subtract 1 due to the zero-th index being the center.
-    for (size_t I = 0; I < Vertices.size() - 1; I++)
+    // Each point on the edge is split into an inner vertex with the full color and an outer
+    // vertex that is transparent, centered on the edge.
+    m_Buffer.AddVertex(Center, Col);
+    uint32_t Points = 0;
+    for (int I = 0; I < Count; I++)
     {
-        m_Buffer.AddIndex(0);
-        m_Buffer.AddIndex(Offset + I + 1);
-        m_Buffer.AddIndex(Offset + I + 2);
+        const ArcSpan& Span = Spans[I];
+        for (const Vector2& Normal : *Span.Points)
+        {
+            const Vector2 Point = Span.Center + Normal * Span.Radius;
+            m_Buffer.AddVertex(Point - Normal * Half, Col);
+            m_Buffer.AddVertex(Point + Normal * Half, Transparent);
+            Points++;
+        }
+    }
+
+    const uint32_t Edges = Closed ? Points : Points - 1;
+    for (uint32_t I = 0; I < Edges; I++)
+    {
+        const uint32_t Inner = Offset + 1 + I * 2;
+        const uint32_t NextInner = Offset + 1 + ((I + 1) % Points) * 2;
+
+        m_Buffer.AddIndex(Offset);
+        m_Buffer.AddIndex(Inner);
+        m_Buffer.AddIndex(NextInner);
+
+        m_Buffer.AddIndex(Inner);
+        m_Buffer.AddIndex(Inner + 1);
+        m_Buffer.AddIndex(NextInner + 1);
+        m_Buffer.AddIndex(Inner);
+        m_Buffer.AddIndex(NextInner + 1);
+        m_Buffer.AddIndex(NextInner);
+    }
+
+    return 1 + Points * 2;
+}
+
+void Paint::AddFeatheredArc(const Vector2& Center, float Radius, const std::vector<Vector2>& Points, const Color& Col, float Thickness)
+{
+    const float HalfCore = std::max<float>(Thickness - FEATHER_WIDTH, 0.0f) * 0.5f;
+    const float HalfWidth = HalfCore + FEATHER_WIDTH;
+    const Color Core(Col.R, Col.G, Col.B, (uint8_t)(Col.A * std::min<float>(Thickness / FEATHER_WIDTH, 1.0f)));
+    const Color Transparent(Col.R, Col.G, Col.B, 0);
+
+    // The same four vertices across as a feathered line, offset along the circle's normal so
+    // that neighboring segments share their vertices.
+    for (const Vector2& Normal : Points)
+    {
+        const Vector2 Point = Center + Normal * Radius;
+        m_Buffer.AddVertex(Point + Normal * HalfWidth, Transparent);
+        m_Buffer.AddVertex(Point + Normal * HalfCore, Core);
+        m_Buffer.AddVertex(Point - Normal * HalfCore, Core);
+        m_Buffer.AddVertex(Point - Normal * HalfWidth, Transparent);
     }
+
+    for (uint32_t Segment = 0; Segment + 1 < (uint32_t)Points.size(); Segment++)
+    {
+        const uint32_t Offset = Segment * 4;
+        for (uint32_t I = Offset; I < Offset + 3; I++)
+        {
+            m_Buffer.AddIndex(I);
+            m_Buffer.AddIndex(I + 1);
+            m_Buffer.AddIndex(I + 5);
+            m_Buffer.AddIndex(I);
+            m_Buffer.AddIndex(I + 5);
+            m_Buffer.AddIndex(I + 4);
+        }
+    }
+}
+
+int Paint::ArcSteps(float Radius) const
+{
+    return GetArcSteps(Radius, m_AntiAliased ? FEATHERED_ARC_TOLERANCE : ARC_TOLERANCE);
 }
 
 void Paint::AddTriangleIndices(uint32_t Offset)
@@ -498,28 +870,29 @@ void Paint::AddTriangleIndices(uint32_t Offset)
     m_Buffer.AddIndex(Offset + 3);
 }
 
-DrawCommand& Paint::PushCommand(uint32_t IndexCount, uint32_t TextureID)
+DrawCommand& Paint::PushCommand(uint32_t IndexCount, uint32_t TextureID, bool DistanceField)
 {
-    return m_Buffer.PushCommand(IndexCount, TextureID, !m_ClipStack.empty() ? m_ClipStack.back() : Rect());
+    return m_Buffer.PushCommand(IndexCount, TextureID, !m_ClipStack.empty() ? m_ClipStack.back() : Rect(), DistanceField);
 }
 
-int Paint::GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents, std::vector<Rect>& Rects, std::vector<Rect>& UVs, bool ShouldClip)
+int Paint::GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents, std::vector<Rect>& Rects, std::vector<Rect>& UVs, std::vector<uint32_t>* Cells, bool ShouldClip)
 {
     int Result = 0;
     const Rect Clip = !m_ClipStack.empty() ? m_ClipStack.back() : Rect();
+    const float FontSize = InFont->Size();
     for (char32_t Char : Contents)
     {
         if (Char == '\n')
         {
             Position.X = Origin.X;
-            Position.Y += InFont->Size();
+            Position.Y += FontSize;
             continue;
         }
 
         if (!Clip.IsZero())
         {
             // Don't check for < Clip.Min.X since size of glyph is not known here.
-            if (ShouldClip && (Position.X > Clip.Max.X || Position.Y > Clip.Max.Y || Position.Y + InFont->Size() < Clip.Min.Y))
+            if (ShouldClip && (Position.X > Clip.Max.X || Position.Y > Clip.Max.Y || Position.Y + FontSize < Clip.Min.Y))
             {
                 continue;
             }
@@ -528,7 +901,7 @@ int Paint::GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position,
         Rect Vertices;
         Rect TexCoords;
 
-        InFont->Draw((uint32_t)Char, Position, Vertices, TexCoords);
+        InFont->Draw((uint32_t)Char, Position, Vertices, TexCoords, Cells);
 
         if (!(ShouldClip && IsClipped(Vertices)))
         {
@@ -541,4 +914,27 @@ int Paint::GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position,
     return Result;
 }
 
+void Paint::RecordFont(const std::shared_ptr<Font>& InFont, uint32_t Revision, const std::vector<uint32_t>& Cells)
+{
+    if (m_Fonts == nullptr)
+    {
+        return;
+    }
+
+    for (FontRecord& Record : *m_Fonts)
+    {
+        if (Record.Source == InFont && Record.Revision == Revision)
+        {
+            Record.Cells.insert(Record.Cells.end(), Cells.begin(), Cells.end());
+            return;
+        }
+    }
+
+    FontRecord Record;
+    Record.Source = InFont;
+    Record.Revision = Revision;
+    Record.Cells = Cells;
+    m_Fonts->push_back(std::move(Record));
+}
+
 }
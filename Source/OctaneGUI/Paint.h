@@ -39,6 +39,7 @@ namespace OctaneGUI
 
 struct Rect;
 class Font;
+class TextLayout;
 struct TextSpan;
 class Texture;
 class Theme;
@@ -46,8 +47,20 @@ class Theme;
 class Paint
 {
 public:
-    Paint();
-    Paint(const std::shared_ptr<Theme>& InTheme);
+    /// @brief A font that recorded commands drew glyphs with.
+    struct FontRecord
+    {
+    public:
+        std::shared_ptr<Font> Source { nullptr };
+
+        // The font's glyph revision when the first glyph was drawn.
+        uint32_t Revision { 0 };
+
+        // Cells of the dynamic glyphs that were drawn.
+        std::vector<uint32_t> Cells {};
+    };
+
+    Paint(VertexBuffer& Buffer, const std::shared_ptr<Theme>& InTheme);
     ~Paint();
 
     void Line(const Vector2& Start, const Vector2& End, const Color& Col, float Thickness = 1.0f);
@@ -59,33 +72,125 @@ public:
     void Text(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const Color& Col);
     void Textf(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const std::vector<TextSpan>& Spans);
     void TextWrapped(const std::shared_ptr<Font>& InFont, const Vector2& Position, const std::u32string_view& Contents, const std::vector<TextSpan>& Spans, float Width);
+
+    /// @brief Copies the glyphs of a text layout into the buffer.
+    ///
+    /// Only glyphs within one of the spans are drawn. Lines outside of the current clip
+    /// are skipped.
+    ///
+    /// @param Layout Layout that was updated with the contents the spans refer to.
+    /// @param Position Top left of the text. Should be on a whole pixel to match how glyphs are positioned.
+    /// @param Spans Ranges of the contents to draw with the color of each range.
+    void Text(const TextLayout& Layout, const Vector2& Position, const std::vector<TextSpan>& Spans);
     void Image(const Rect& Bounds, const Rect& TexCoords, const std::shared_ptr<Texture>& InTexture, const Color& Col);
-    void Circle(const Vector2& Center, float Radius, const Color& Tint, int Steps = 64);
-    void CircleOutline(const Vector2& Center, float Radius, const Color& Tint, float Thickness = 1.0f, int Steps = 64);
-    void Arc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, int Steps = 32);
-    void ArcOutline(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, float Thickness = 1.0f, int Steps = 32);
+
+    /// @brief Draws a filled circle.
+    ///
+    /// The points of the circle come from a table that is computed once for each step count.
+    /// Arcs use the points of the same tables that fall between their angles.
+    ///
+    /// @param Steps Number of segments for a full circle, up to 64. Zero picks a count from the
+    /// radius so that each segment stays within a quarter of a pixel of the curve.
+    void Circle(const Vector2& Center, float Radius, const Color& Tint, int Steps = 0);
+    void CircleOutline(const Vector2& Center, float Radius, const Color& Tint, float Thickness = 1.0f, int Steps = 0);
+    void Arc(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, int Steps = 0);
+    void ArcOutline(const Vector2& Center, float Radius, float StartAngle, float EndAngle, const Color& Tint, float Thickness = 1.0f, int Steps = 0);
 
     void PushClip(const Rect& Bounds);
     void PopClip();
     bool IsClipped(const Rect& Bounds) const;
+    Rect CurrentClip() const;
+
+    /// @brief Limits painting to the controls that overlap the given regions.
+    ///
+    /// An empty list means the whole window is being painted. Containers will skip any
+    /// child whose bounds do not intersect one of these regions.
+    ///
+    /// @param Damage List of absolute regions that need to be repainted.
+    /// @return This Paint reference.
+    Paint& SetDamage(const std::vector<Rect>& Damage);
+    const std::vector<Rect>& Damage() const;
+    bool IsDamaged(const Rect& Bounds) const;
+
+    /// @brief Temporarily ignores the damage regions so that everything is painted.
+    ///
+    /// Calls can be nested and must be balanced with a call passing false.
+    ///
+    /// @param Suspend True to ignore the damage regions, false to restore them.
+    /// @return This Paint reference.
+    Paint& SuspendDamage(bool Suspend);
+
+    /// @brief Copies previously captured paint commands into this brush's buffer.
+    /// @param Source Buffer containing the commands to replay.
+    void Replay(const VertexBuffer& Source);
+
+    /// @brief Records the fonts used by text painted until EndRecordFonts is called.
+    ///
+    /// Recordings can be nested. Everything recorded is also added to the recording that was
+    /// active when this was called.
+    ///
+    /// @param Fonts List the fonts are added to.
+    /// @return The recording that was active, which must be passed to EndRecordFonts.
+    std::vector<FontRecord>* BeginRecordFonts(std::vector<FontRecord>& Fonts);
+    void EndRecordFonts(std::vector<FontRecord>* Previous);
+
+    /// @brief Checks if text recorded with BeginRecordFonts can be replayed.
+    ///
+    /// Glyphs of a font are moved or replaced when its glyph revision changes, so recorded
+    /// coordinates are only valid while every revision matches. The dynamic glyphs of valid
+    /// recordings are marked as drawn this frame and added to the active recording.
+    ///
+    /// @param Fonts The recorded fonts.
+    /// @return False if the text needs to be painted again.
+    bool UseFonts(const std::vector<FontRecord>& Fonts);
+
+    /// @brief Starts a new draw command on the next paint call instead of merging with the previous one.
+    void BreakBatch();
+
+    /// @brief Feathers the edges of lines, circles, arcs and rounded rectangles.
+    ///
+    /// Each edge gets a one pixel wide fringe that fades from the shape's color to transparent,
+    /// which smooths the edge without multisampling. Curves are tessellated with fewer steps
+    /// in this mode as the fringe hides the corners between segments. Defaults to the theme's
+    /// AntiAliasing flag.
+    ///
+    /// @param AntiAliased True to feather the edges.
+    /// @return This Paint reference.
+    Paint& SetAntiAliased(bool AntiAliased);
+    bool AntiAliased() const;
 
     const VertexBuffer& GetBuffer() const;
     std::shared_ptr<Theme> GetTheme() const;
 
 private:
+    struct ArcSpan;
+
     void AddLine(const Vector2& Start, const Vector2& End, const Color& Col, float Thickness, uint32_t IndexOffset = 0);
     void AddTriangles(const Rect& Vertices, const Color& Col, uint32_t IndexOffset = 0);
     void AddTriangles(const Rect& Vertices, const Rect& TexCoords, const Color& Col, uint32_t IndexOffset = 0);
-    void AddTriangles(const std::vector<Rect>& Rects, const std::vector<Rect>& UVs, const std::vector<Color>& Colors, uint32_t TextureID);
-    void AddTrianglesCircle(const Vector2& Center, const std::vector<Vector2>& Vertices, const Color& Tint, uint32_t Offset = 0);
+    void AddTriangles(const std::vector<Rect>& Rects, const std::vector<Rect>& UVs, const std::vector<Color>& Colors, uint32_t TextureID, bool DistanceField = false);
+    uint32_t AddTrianglesArc(const Vector2& Center, float Radius, const std::vector<Vector2>& Points, const Color& Tint, uint32_t Offset = 0);
+    void AddLinesArc(const Vector2& Center, float Radius, const std::vector<Vector2>& Points, const Color& Tint, float Thickness);
+    void AddFeatheredLine(const Vector2& Start, const Vector2& End, const Color& Col, float Thickness);
+    uint32_t AddFeatheredFan(const Vector2& Center, const ArcSpan* Spans, int Count, bool Closed, const Color& Col, uint32_t Offset = 0);
+    void AddFeatheredArc(const Vector2& Center, float Radius, const std::vector<Vector2>& Points, const Color& Col, float Thickness);
+    int ArcSteps(float Radius) const;
     void AddTriangleIndices(uint32_t Offset);
-    DrawCommand& PushCommand(uint32_t IndexCount, uint32_t TextureID);
+    DrawCommand& PushCommand(uint32_t IndexCount, uint32_t TextureID, bool DistanceField = false);
 
-    int GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents, std::vector<Rect>& Rects, std::vector<Rect>& UVs, bool ShouldClip = true);
+    int GatherGlyphs(const std::shared_ptr<Font>& InFont, Vector2& Position, const Vector2& Origin, const std::u32string_view& Contents, std::vector<Rect>& Rects, std::vector<Rect>& UVs, std::vector<uint32_t>* Cells, bool ShouldClip = true);
+    void RecordFont(const std::shared_ptr<Font>& InFont, uint32_t Revision, const std::vector<uint32_t>& Cells);
 
     std::shared_ptr<Theme> m_Theme;
     std::vector<Rect> m_ClipStack;
-    VertexBuffer m_Buffer;
+    std::vector<Rect> m_Damage;
+    int m_DamageSuspended { 0 };
+    bool m_AntiAliased { false };
+    VertexBuffer& m_Buffer;
+    std::vector<FontRecord>* m_Fonts { nullptr };
+
+    // Points of the arcs being drawn. Rounded rectangles need one list for each corner.
+    std::vector<Vector2> m_Arcs[4] {};
 };
 
 }
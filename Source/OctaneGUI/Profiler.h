@@ -34,12 +34,20 @@ namespace OctaneGUI
 {
 
 #if TOOLS
-    #define PROFILER_SAMPLE(Name) Tools::Profiler::Sample Sample(Name, false)
-    #define PROFILER_SAMPLE_GROUP(Name) Tools::Profiler::Sample Sample(Name, true)
+    #define PROFILER_SAMPLE(Name)                                                                \
+        static const Tools::Profiler::ID ProfilerSampleID = Tools::Profiler::Get().Register(Name); \
+        Tools::Profiler::Sample Sample(ProfilerSampleID, false)
+    #define PROFILER_SAMPLE_GROUP(Name)                                                          \
+        static const Tools::Profiler::ID ProfilerSampleID = Tools::Profiler::Get().Register(Name); \
+        Tools::Profiler::Sample Sample(ProfilerSampleID, true)
+    #define PROFILER_SAMPLE_GROUP_KEY(Prefix, Key, Suffix)                        \
+        static Tools::Profiler::NameCache ProfilerSampleNames(Prefix, Suffix); \
+        Tools::Profiler::Sample Sample(ProfilerSampleNames.Get(Key), true)
     #define PROFILER_FRAME() Tools::Profiler::Frame Frame(true)
 #else
     #define PROFILER_SAMPLE(Name)
     #define PROFILER_SAMPLE_GROUP(Name)
+    #define PROFILER_SAMPLE_GROUP_KEY(Prefix, Key, Suffix)
     #define PROFILER_FRAME()
 #endif
 
@@ -0,0 +1,122 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "TaskPool.h"
+
+#include <algorithm>
+
+namespace OctaneGUI
+{
+
+TaskPool::TaskPool(uint32_t MaxThreads)
+    : m_MaxThreads(MaxThreads)
+{
+    if (m_MaxThreads == 0)
+    {
+        m_MaxThreads = std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+    }
+}
+
+TaskPool::~TaskPool()
+{
+    {
+        std::lock_guard<std::mutex> Lock(m_Mutex);
+        m_Stop = true;
+    }
+
+    m_TaskAdded.notify_all();
+
+    for (std::thread& Thread : m_Threads)
+    {
+        Thread.join();
+    }
+}
+
+void TaskPool::Add(Task&& Fn)
+{
+    {
+        std::lock_guard<std::mutex> Lock(m_Mutex);
+        m_Tasks.push_back(std::move(Fn));
+
+        // Only start another worker if the idle ones can't pick up every queued task.
+        if (m_Idle < m_Tasks.size() && m_Threads.size() < m_MaxThreads)
+        {
+            m_Threads.emplace_back(&TaskPool::Work, this);
+        }
+    }
+
+    m_TaskAdded.notify_one();
+}
+
+void TaskPool::Wait()
+{
+    std::unique_lock<std::mutex> Lock(m_Mutex);
+    m_TasksDone.wait(Lock, [this]() -> bool
+        {
+            return m_Tasks.empty() && m_Running == 0;
+        });
+}
+
+uint32_t TaskPool::MaxThreads() const
+{
+    return m_MaxThreads;
+}
+
+void TaskPool::Work()
+{
+    std::unique_lock<std::mutex> Lock(m_Mutex);
+
+    while (true)
+    {
+        m_Idle++;
+        m_TaskAdded.wait(Lock, [this]() -> bool
+            {
+                return m_Stop || !m_Tasks.empty();
+            });
+        m_Idle--;
+
+        if (m_Tasks.empty())
+        {
+            break;
+        }
+
+        Task Fn = std::move(m_Tasks.front());
+        m_Tasks.pop_front();
+        m_Running++;
+
+        Lock.unlock();
+        Fn();
+        Lock.lock();
+
+        m_Running--;
+        if (m_Tasks.empty() && m_Running == 0)
+        {
+            m_TasksDone.notify_all();
+        }
+    }
+}
+
+}
@@ -0,0 +1,80 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+/// @brief Runs tasks on a set of worker threads.
+///
+/// Workers are started as tasks are added, up to the maximum number of threads
+/// given to the constructor. Tasks must not touch any rendering state, such as
+/// loading textures, as they do not run on the main thread. Wait should be called
+/// before using any results produced by the tasks.
+class TaskPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    /// @brief Creates a pool that starts at most the given number of workers.
+    /// @param MaxThreads Maximum number of workers. Zero uses the number of hardware threads.
+    TaskPool(uint32_t MaxThreads = 0);
+    ~TaskPool();
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    void Add(Task&& Fn);
+
+    /// @brief Blocks until every task added to the pool has finished.
+    void Wait();
+
+    uint32_t MaxThreads() const;
+
+private:
+    void Work();
+
+    std::vector<std::thread> m_Threads {};
+    std::deque<Task> m_Tasks {};
+    std::mutex m_Mutex {};
+    std::condition_variable m_TaskAdded {};
+    std::condition_variable m_TasksDone {};
+    uint32_t m_MaxThreads { 0 };
+    uint32_t m_Idle { 0 };
+    uint32_t m_Running { 0 };
+    bool m_Stop { false };
+};
+
+}
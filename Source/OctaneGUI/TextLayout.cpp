@@ -0,0 +1,217 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "TextLayout.h"
+#include "Font.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace OctaneGUI
+{
+
+TextLayout::TextLayout()
+{
+}
+
+bool TextLayout::Update(const std::shared_ptr<Font>& InFont, const std::u32string_view& Contents, uint32_t Version, float Wrap)
+{
+    if (!InFont)
+    {
+        return false;
+    }
+
+    if (m_Valid
+        && m_Font == InFont
+        && m_Version == Version
+        && m_Wrap == Wrap
+        && m_GlyphRevision == InFont->GlyphRevision())
+    {
+        return false;
+    }
+
+    m_Font = InFont;
+    m_Version = Version;
+    m_Wrap = Wrap;
+
+    // A glyph loaded while building may grow the font's atlas, which moves the glyphs placed
+    // before it. The layout is built again until no glyph changes while building.
+    do
+    {
+        m_GlyphRevision = InFont->GlyphRevision();
+        Build(Contents);
+    } while (m_GlyphRevision != InFont->GlyphRevision());
+
+    m_Valid = true;
+    return true;
+}
+
+void TextLayout::Invalidate()
+{
+    m_Valid = false;
+}
+
+const std::shared_ptr<Font>& TextLayout::GetFont() const
+{
+    return m_Font;
+}
+
+Vector2 TextLayout::Size() const
+{
+    if (!m_Font)
+    {
+        return {};
+    }
+
+    return { m_Width, m_Font->Size() * (float)m_Lines.size() };
+}
+
+uint32_t TextLayout::LineCount() const
+{
+    return (uint32_t)m_Lines.size();
+}
+
+const std::vector<TextLayout::Line>& TextLayout::Lines() const
+{
+    return m_Lines;
+}
+
+const std::vector<Rect>& TextLayout::Rects() const
+{
+    return m_Rects;
+}
+
+const std::vector<Rect>& TextLayout::UVs() const
+{
+    return m_UVs;
+}
+
+const std::vector<uint32_t>& TextLayout::Indices() const
+{
+    return m_Indices;
+}
+
+const std::vector<uint32_t>& TextLayout::Cells() const
+{
+    return m_Cells;
+}
+
+uint32_t TextLayout::GlyphRevision() const
+{
+    return m_GlyphRevision;
+}
+
+void TextLayout::Build(const std::u32string_view& Contents)
+{
+    // Clearing keeps the capacity, so building the layout again rarely allocates.
+    m_Lines.clear();
+    m_Rects.clear();
+    m_UVs.clear();
+    m_Indices.clear();
+    m_Cells.clear();
+    m_Width = 0.0f;
+
+    const float LineHeight = m_Font->Size();
+    const uint32_t Length = (uint32_t)Contents.length();
+    const auto DrawWord = [&](uint32_t Start, uint32_t End, Vector2& Position) -> void
+    {
+        for (uint32_t I = Start; I < End; I++)
+        {
+            if (Contents[I] == U'\n')
+            {
+                continue;
+            }
+
+            Rect Vertices;
+            Rect TexCoords;
+            m_Font->Draw((uint32_t)Contents[I], Position, Vertices, TexCoords, &m_Cells);
+            m_Rects.push_back(Vertices);
+            m_UVs.push_back(TexCoords);
+            m_Indices.push_back(I);
+        }
+    };
+
+    Vector2 Position;
+    AddLine(0);
+
+    uint32_t Start = 0;
+    while (Start < Length)
+    {
+        // Each word includes the whitespace character that ends it.
+        uint32_t End = Start;
+        while (End < Length && !std::isspace(Contents[End]))
+        {
+            End++;
+        }
+        End = std::min<uint32_t>(End + 1, Length);
+
+        const float WordStart = Position.X;
+        const size_t FirstGlyph = m_Rects.size();
+        DrawWord(Start, End, Position);
+
+        // The glyphs are positioned from the pen, so a word moved to the next line is drawn again
+        // instead of offset. A word that starts a line is kept even if it is wider than the wrap width.
+        if (m_Wrap > 0.0f && WordStart > 0.0f && Position.X > m_Wrap)
+        {
+            m_Rects.resize(FirstGlyph);
+            m_UVs.resize(FirstGlyph);
+            m_Indices.resize(FirstGlyph);
+            m_Lines.back().Width = WordStart;
+
+            Position = { 0.0f, Position.Y + LineHeight };
+            AddLine(Start);
+            DrawWord(Start, End, Position);
+        }
+
+        m_Lines.back().Width = Position.X;
+
+        if (Contents[End - 1] == U'\n')
+        {
+            Position = { 0.0f, Position.Y + LineHeight };
+            AddLine(End);
+        }
+
+        Start = End;
+    }
+
+    for (const Line& Item : m_Lines)
+    {
+        m_Width = std::max<float>(m_Width, Item.Width);
+    }
+
+    std::sort(m_Cells.begin(), m_Cells.end());
+    m_Cells.erase(std::unique(m_Cells.begin(), m_Cells.end()), m_Cells.end());
+}
+
+void TextLayout::AddLine(uint32_t Start)
+{
+    Line Item;
+    Item.Start = Start;
+    Item.Glyph = (uint32_t)m_Rects.size();
+    m_Lines.push_back(Item);
+}
+
+}
@@ -0,0 +1,112 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "Rect.h"
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class Font;
+
+/// @brief Positioned glyphs of a block of text, broken into lines.
+///
+/// Lines are broken at newline characters and, when a wrap width is given, before any word
+/// that would extend past that width. Glyph positions are relative to the top left of the
+/// text. The layout is only built again when the font, the wrap width, the version of the
+/// contents or the font's glyph revision changes, so unchanged text can be copied straight
+/// into a VertexBuffer with Paint::Text.
+class TextLayout
+{
+public:
+    struct Line
+    {
+        // Index into the contents of the first character on this line.
+        uint32_t Start { 0 };
+        // Index of the first glyph on this line.
+        uint32_t Glyph { 0 };
+        float Width { 0.0f };
+    };
+
+    TextLayout();
+
+    /// @brief Builds the layout if any of its inputs have changed.
+    ///
+    /// @param InFont Font used to position the glyphs.
+    /// @param Contents Text to lay out.
+    /// @param Version Caller defined version of the contents. Must change whenever the contents change.
+    /// @param Wrap Width at which lines are wrapped. Zero or less disables wrapping.
+    /// @return True if the layout was built again.
+    bool Update(const std::shared_ptr<Font>& InFont, const std::u32string_view& Contents, uint32_t Version, float Wrap = 0.0f);
+
+    /// @brief Forces the next call to Update to build the layout.
+    void Invalidate();
+
+    const std::shared_ptr<Font>& GetFont() const;
+    Vector2 Size() const;
+    uint32_t LineCount() const;
+    const std::vector<Line>& Lines() const;
+
+    /// @brief Vertices of each glyph relative to the top left of the text.
+    const std::vector<Rect>& Rects() const;
+    const std::vector<Rect>& UVs() const;
+
+    /// @brief Index into the contents of the character each glyph was drawn for. Always increasing.
+    const std::vector<uint32_t>& Indices() const;
+
+    /// @brief Cells of the font's dynamic glyphs used by this layout.
+    ///
+    /// Paint::Text marks these as drawn since the glyphs are copied without going through the font.
+    const std::vector<uint32_t>& Cells() const;
+
+    /// @brief The font's glyph revision the coordinates of the glyphs are valid for.
+    uint32_t GlyphRevision() const;
+
+private:
+    void Build(const std::u32string_view& Contents);
+    void AddLine(uint32_t Start);
+
+    std::shared_ptr<Font> m_Font { nullptr };
+    uint32_t m_Version { 0 };
+    uint32_t m_GlyphRevision { 0 };
+    float m_Wrap { 0.0f };
+    bool m_Valid { false };
+
+    std::vector<Line> m_Lines {};
+    std::vector<Rect> m_Rects {};
+    std::vector<Rect> m_UVs {};
+    std::vector<uint32_t> m_Indices {};
+    std::vector<uint32_t> m_Cells {};
+    float m_Width { 0.0f };
+};
+
+}
@@ -32,6 +32,8 @@ SOFTWARE.
 #include "External/nanosvg/nanosvgrast.h"
 #include "External/stb/stb_image.h"
 #include "FileSystem.h"
+#include "Rect.h"
+#include "TextureAtlas.h"
 
 #include <cstring>
 
@@ -60,12 +62,47 @@ std::vector<uint8_t> RasterSVG(NSVGimage* Image, float Width, float Height)
 }
 
 Texture::OnLoadSignature Texture::s_OnLoad = nullptr;
+Texture::OnUpdateSignature Texture::s_OnUpdate = nullptr;
+Texture::OnUnloadSignature Texture::s_OnUnload = nullptr;
+std::unique_ptr<TextureAtlas> Texture::s_Atlas = nullptr;
 
 void Texture::SetOnLoad(OnLoadSignature Fn)
 {
     s_OnLoad = Fn;
 }
 
+void Texture::SetOnUpdate(OnUpdateSignature Fn)
+{
+    s_OnUpdate = Fn;
+}
+
+void Texture::SetOnUnload(OnUnloadSignature Fn)
+{
+    s_OnUnload = Fn;
+}
+
+bool Texture::CanUpdate()
+{
+    return s_OnUpdate != nullptr;
+}
+
+void Texture::SetAtlasPageSize(uint32_t PageSize)
+{
+    if (PageSize == 0)
+    {
+        s_Atlas = nullptr;
+    }
+    else if (!s_Atlas || s_Atlas->PageSize() != PageSize)
+    {
+        s_Atlas = std::make_unique<TextureAtlas>(PageSize);
+    }
+}
+
+uint32_t Texture::AtlasPageCount()
+{
+    return s_Atlas ? s_Atlas->PageCount() : 0;
+}
+
 std::shared_ptr<Texture> Texture::Load(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
 {
     std::shared_ptr<Texture> Result;
@@ -86,58 +123,91 @@ std::shared_ptr<Texture> Texture::Load(const std::vector<uint8_t>& Data, uint32_
     return Result;
 }
 
-std::shared_ptr<Texture> Texture::Load(const char* Path)
+std::shared_ptr<Texture> Texture::LoadShared(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height)
+{
+    if (!s_Atlas)
+    {
+        return Load(Data, Width, Height);
+    }
+
+    Vector2 Position;
+    const std::shared_ptr<Texture> Page = s_Atlas->Add(Data, Width, Height, Position);
+    if (!Page)
+    {
+        return Load(Data, Width, Height);
+    }
+
+    std::shared_ptr<Texture> Result = std::make_shared<Texture>();
+    Result->m_ID = Page->m_ID;
+    Result->m_Size = { (float)Width, (float)Height };
+    Result->m_Offset = Position;
+    Result->m_PageSize = Page->m_Size;
+    return Result;
+}
+
+std::shared_ptr<Texture> Texture::Load(const char* Path, bool Shared)
 {
     std::shared_ptr<Texture> Result { nullptr };
 
     const std::string Extension = FileSystem::Extension(Path);
     if (Extension == ".png")
     {
-        Result = LoadPNG(Path);
+        Result = LoadPNG(Path, Shared);
     }
     else if (Extension == ".svg")
     {
-        Result = LoadSVG(Path);
+        Result = LoadSVG(Path, Shared);
     }
 
     return Result;
 }
 
-std::shared_ptr<Texture> Texture::LoadPNG(const char* Path)
+std::shared_ptr<Texture> Texture::LoadPNG(const char* Path, bool Shared)
 {
     std::shared_ptr<Texture> Result;
 
+    // Atlas pages only hold RGBA32 pixels.
     int Width, Height, Channels;
-    uint8_t* Data = stbi_load(Path, &Width, &Height, &Channels, 0);
+    uint8_t* Data = stbi_load(Path, &Width, &Height, &Channels, Shared ? 4 : 0);
     if (Data != nullptr)
     {
+        if (Shared)
+        {
+            Channels = 4;
+        }
+
         std::vector<uint8_t> Buffer;
         Buffer.resize(Width * Height * Channels);
         std::memcpy(&Buffer[0], Data, Buffer.size());
         stbi_image_free(Data);
 
-        Result = Load(Buffer, Width, Height);
-        Result->m_Path = Path;
+        Result = Shared ? LoadShared(Buffer, Width, Height) : Load(Buffer, Width, Height);
+        if (Result)
+        {
+            Result->m_Path = Path;
+        }
     }
 
     return Result;
 }
 
-std::shared_ptr<Texture> Texture::LoadSVG(const char* Path)
+std::shared_ptr<Texture> Texture::LoadSVG(const char* Path, bool Shared)
 {
     std::shared_ptr<Texture> Result { nullptr };
 
     NSVGimage* Image = nsvgParseFromFile(Path, "px", 96);
     if (Image != nullptr)
     {
+        const uint32_t Width = (uint32_t)Image->width;
+        const uint32_t Height = (uint32_t)Image->height;
         const std::vector<uint8_t> Data = RasterSVG(Image, Image->width, Image->height);
-        Result = Load(Data, (uint32_t)Image->width, (uint32_t)Image->height);
+        Result = Shared ? LoadShared(Data, Width, Height) : Load(Data, Width, Height);
     }
 
     return Result;
 }
 
-std::shared_ptr<Texture> Texture::LoadSVG(const char* Path, uint32_t Width, uint32_t Height)
+std::shared_ptr<Texture> Texture::LoadSVG(const char* Path, uint32_t Width, uint32_t Height, bool Shared)
 {
     std::shared_ptr<Texture> Result { nullptr };
 
@@ -145,7 +215,7 @@ std::shared_ptr<Texture> Texture::LoadSVG(const char* Path, uint32_t Width, uint
     if (Image != nullptr)
     {
         const std::vector<uint8_t> Data = RasterSVG(Image, (float)Width, (float)Height);
-        Result = Load(Data, Width, Height);
+        Result = Shared ? LoadShared(Data, Width, Height) : Load(Data, Width, Height);
     }
 
     return Result;
@@ -172,6 +242,46 @@ Texture::~Texture()
 {
 }
 
+bool Texture::Update(const std::vector<uint8_t>& Data, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
+{
+    if (!s_OnUpdate || m_ID == 0)
+    {
+        return false;
+    }
+
+    s_OnUpdate(m_ID, Data, (uint32_t)m_Offset.X + X, (uint32_t)m_Offset.Y + Y, Width, Height);
+    return true;
+}
+
+void Texture::Unload()
+{
+    if (m_ID == 0 || IsShared())
+    {
+        return;
+    }
+
+    if (s_OnUnload)
+    {
+        s_OnUnload(m_ID);
+    }
+
+    m_ID = 0;
+}
+
+Rect Texture::Normalize(const Rect& Region) const
+{
+    const Vector2 PageSize = IsShared() ? m_PageSize : m_Size;
+    return {
+        (Region.Min + m_Offset) / PageSize,
+        (Region.Max + m_Offset) / PageSize
+    };
+}
+
+bool Texture::IsShared() const
+{
+    return m_PageSize.X > 0.0f;
+}
+
 bool Texture::IsValid() const
 {
     return m_ID != 0;
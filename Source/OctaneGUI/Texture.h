@@ -37,22 +37,74 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
+struct Rect;
+class TextureAtlas;
+
+/// @brief Image that has been uploaded to the renderer.
+///
+/// A texture may be a region of a larger shared page when loaded with LoadShared. Sizes
+/// and pixel coordinates are always relative to the region, while Normalize should be
+/// used to get the texture coordinates to draw with.
 class Texture
 {
 public:
     typedef std::function<uint32_t(const std::vector<uint8_t>&, uint32_t, uint32_t)> OnLoadSignature;
+    typedef std::function<void(uint32_t, const std::vector<uint8_t>&, uint32_t, uint32_t, uint32_t, uint32_t)> OnUpdateSignature;
+    typedef std::function<void(uint32_t)> OnUnloadSignature;
 
     static void SetOnLoad(OnLoadSignature Fn);
+    static void SetOnUpdate(OnUpdateSignature Fn);
+    static void SetOnUnload(OnUnloadSignature Fn);
+
+    /// @brief Whether the frontend supports replacing a region of a texture with Update.
+    static bool CanUpdate();
+
+    /// @brief Enables packing textures loaded with LoadShared into pages of the given size.
+    ///
+    /// A size of zero disables this, which is the default. Textures already placed in a page
+    /// stay valid, but later textures are never placed in the existing pages.
+    static void SetAtlasPageSize(uint32_t PageSize);
+    static uint32_t AtlasPageCount();
+
     static std::shared_ptr<Texture> Load(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height);
-    static std::shared_ptr<Texture> Load(const char* Path);
-    static std::shared_ptr<Texture> LoadPNG(const char* Path);
-    static std::shared_ptr<Texture> LoadSVG(const char* Path);
-    static std::shared_ptr<Texture> LoadSVG(const char* Path, uint32_t Width, uint32_t Height);
+
+    /// @brief Places the image into a shared atlas page if one is enabled.
+    ///
+    /// Falls back to loading a texture of its own if the atlas is disabled or the image
+    /// does not fit within a page.
+    static std::shared_ptr<Texture> LoadShared(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height);
+
+    static std::shared_ptr<Texture> Load(const char* Path, bool Shared = false);
+    static std::shared_ptr<Texture> LoadPNG(const char* Path, bool Shared = false);
+    static std::shared_ptr<Texture> LoadSVG(const char* Path, bool Shared = false);
+    static std::shared_ptr<Texture> LoadSVG(const char* Path, uint32_t Width, uint32_t Height, bool Shared = false);
     static std::vector<uint8_t> LoadSVGData(const char* Path, uint32_t Width, uint32_t Height);
 
     Texture();
     ~Texture();
 
+    /// @brief Replaces a region of the texture with new pixel data.
+    ///
+    /// @param Data RGBA32 pixels of the region only.
+    /// @param X Left of the region in pixels.
+    /// @param Y Top of the region in pixels.
+    /// @param Width Width of the region in pixels.
+    /// @param Height Height of the region in pixels.
+    /// @return False if the frontend does not support updating textures.
+    bool Update(const std::vector<uint8_t>& Data, uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height);
+
+    /// @brief Releases the texture from the renderer.
+    ///
+    /// The texture is invalid afterwards and must no longer be drawn with. Regions of a shared
+    /// page are left alone as other textures may be using the page.
+    void Unload();
+
+    /// @brief Converts a region in pixels to the texture coordinates to draw it with.
+    Rect Normalize(const Rect& Region) const;
+
+    /// @brief Whether this texture is a region of a shared atlas page.
+    bool IsShared() const;
+
     bool IsValid() const;
     uint32_t GetID() const;
     Vector2 GetSize() const;
@@ -60,9 +112,16 @@ public:
 
 private:
     static OnLoadSignature s_OnLoad;
+    static OnUpdateSignature s_OnUpdate;
+    static OnUnloadSignature s_OnUnload;
+    static std::unique_ptr<TextureAtlas> s_Atlas;
 
     uint32_t m_ID { 0 };
     Vector2 m_Size {};
+
+    // Location of the region within its page. The page size is zero for textures that are not shared.
+    Vector2 m_Offset {};
+    Vector2 m_PageSize {};
     std::string m_Path {};
 };
 
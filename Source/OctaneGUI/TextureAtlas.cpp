@@ -0,0 +1,116 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#include "TextureAtlas.h"
+#include "External/stb/stb_rect_pack.h"
+#include "Texture.h"
+
+// Empty pixels kept between images so that filtering does not sample a neighbor.
+#define IMAGE_GAP 1
+
+namespace OctaneGUI
+{
+
+struct TextureAtlas::Page
+{
+public:
+    std::shared_ptr<Texture> Texture_ { nullptr };
+    stbrp_context Context {};
+    std::vector<stbrp_node> Nodes {};
+};
+
+TextureAtlas::TextureAtlas(uint32_t PageSize)
+    : m_PageSize(PageSize)
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+}
+
+std::shared_ptr<Texture> TextureAtlas::Add(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height, Vector2& Position)
+{
+    // Space is only packed once the image is known to be uploaded, otherwise it would never be used.
+    if (!Texture::CanUpdate() || Width == 0 || Height == 0 || Width > m_PageSize / 2 || Height > m_PageSize / 2 || Data.size() < (size_t)Width * Height * 4)
+    {
+        return nullptr;
+    }
+
+    stbrp_rect Rect_ {};
+    Rect_.w = (int)Width + IMAGE_GAP;
+    Rect_.h = (int)Height + IMAGE_GAP;
+
+    // Pages keep their packing state so each image is packed around the ones already added.
+    Page* Target = nullptr;
+    for (const std::unique_ptr<Page>& Item : m_Pages)
+    {
+        if (stbrp_pack_rects(&Item->Context, &Rect_, 1) != 0)
+        {
+            Target = Item.get();
+            break;
+        }
+    }
+
+    if (Target == nullptr)
+    {
+        std::unique_ptr<Page> NewPage = std::make_unique<Page>();
+        NewPage->Texture_ = Texture::Load(std::vector<uint8_t>((size_t)m_PageSize * m_PageSize * 4, 0), m_PageSize, m_PageSize);
+        if (!NewPage->Texture_)
+        {
+            return nullptr;
+        }
+
+        NewPage->Nodes.resize(m_PageSize);
+        stbrp_init_target(&NewPage->Context, (int)m_PageSize, (int)m_PageSize, NewPage->Nodes.data(), (int)NewPage->Nodes.size());
+        stbrp_pack_rects(&NewPage->Context, &Rect_, 1);
+
+        // A new page is only kept once the image was uploaded to it.
+        Position = { (float)Rect_.x, (float)Rect_.y };
+        if (!NewPage->Texture_->Update(Data, (uint32_t)Rect_.x, (uint32_t)Rect_.y, Width, Height))
+        {
+            return nullptr;
+        }
+
+        m_Pages.push_back(std::move(NewPage));
+        return m_Pages.back()->Texture_;
+    }
+
+    Position = { (float)Rect_.x, (float)Rect_.y };
+    Target->Texture_->Update(Data, (uint32_t)Rect_.x, (uint32_t)Rect_.y, Width, Height);
+    return Target->Texture_;
+}
+
+uint32_t TextureAtlas::PageSize() const
+{
+    return m_PageSize;
+}
+
+uint32_t TextureAtlas::PageCount() const
+{
+    return (uint32_t)m_Pages.size();
+}
+
+}
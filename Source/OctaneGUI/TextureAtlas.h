@@ -0,0 +1,77 @@
+/**
+
+MIT License
+
+Copyright (c) 2022 Mitchell Davis <mdavisprog@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "Vector2.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace OctaneGUI
+{
+
+class Texture;
+
+/// @brief Packs many small images into a few large textures.
+///
+/// Each page is a texture of a fixed size. Images are copied into the first page with
+/// enough free space, creating a new page when none fit. Drawing images that share a page
+/// does not require switching textures, which allows their draw commands to be merged.
+/// Images are never removed, so only long lived images should be added.
+class TextureAtlas
+{
+public:
+    TextureAtlas(uint32_t PageSize);
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    /// @brief Copies an image into a page.
+    ///
+    /// Images larger than half of the page size in either dimension are not added so that
+    /// a single image can't take up a whole page.
+    ///
+    /// @param Data RGBA32 pixels of the image.
+    /// @param Width Width of the image in pixels.
+    /// @param Height Height of the image in pixels.
+    /// @param Position Set to the top left of the image within the page.
+    /// @return The page the image was added to, or nullptr if it was not added.
+    std::shared_ptr<Texture> Add(const std::vector<uint8_t>& Data, uint32_t Width, uint32_t Height, Vector2& Position);
+
+    uint32_t PageSize() const;
+    uint32_t PageCount() const;
+
+private:
+    struct Page;
+
+    std::vector<std::unique_ptr<Page>> m_Pages {};
+    uint32_t m_PageSize { 0 };
+};
+
+}
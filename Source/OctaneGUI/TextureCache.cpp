@@ -45,7 +45,7 @@ std::shared_ptr<Texture> TextureCache::Load(const char* Path)
 {
     if (m_Cache.find(Path) == m_Cache.end() && std::strlen(Path) > 0)
     {
-        std::shared_ptr<Texture> Result = Texture::Load(Path);
+        std::shared_ptr<Texture> Result = Texture::Load(Path, true);
 
         if (Result && Result->IsValid())
         {
@@ -61,7 +61,7 @@ std::shared_ptr<Texture> TextureCache::LoadSVG(const char* Path, uint32_t Width,
     std::shared_ptr<Texture>& Result = m_Cache[Path];
     if (!Result)
     {
-        Result = Texture::LoadSVG(Path, Width, Height);
+        Result = Texture::LoadSVG(Path, Width, Height, true);
     }
 
     return m_Cache[Path];
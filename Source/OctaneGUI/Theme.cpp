@@ -27,10 +27,15 @@ SOFTWARE.
 #include "Theme.h"
 #include "Font.h"
 #include "Json.h"
+#include "TaskPool.h"
 #include "ThemeProperties.h"
 
+#include <algorithm>
 #include <fstream>
 
+// Size distance field fonts are rasterized at. Every other size is scaled from this.
+#define DISTANCE_FIELD_SIZE 32.0f
+
 namespace OctaneGUI
 {
 
@@ -59,7 +64,26 @@ std::shared_ptr<Font> Theme::GetOrAddFont(const char* Path, float Size)
         }
     }
 
-    std::shared_ptr<Font> NewFont = Font::Create(Path, Size);
+    std::shared_ptr<Font> NewFont = nullptr;
+    if (m_Properties[ThemeProperties::FontDistanceField].Bool())
+    {
+        std::shared_ptr<Font> Source = GetDistanceField(Path);
+        if (!Source)
+        {
+            Source = Font::Create(Path, DISTANCE_FIELD_SIZE, { Font::BasicLatin, Font::Latin1Supplement }, true);
+            if (Source)
+            {
+                m_DistanceFields.push_back(Source);
+            }
+        }
+
+        NewFont = Font::Create(Source, Size);
+    }
+    else
+    {
+        NewFont = Font::Create(Path, Size);
+    }
+
     if (NewFont)
     {
         m_Fonts.push_back(NewFont);
@@ -68,6 +92,19 @@ std::shared_ptr<Font> Theme::GetOrAddFont(const char* Path, float Size)
     return NewFont;
 }
 
+std::shared_ptr<Font> Theme::GetDistanceField(const char* Path) const
+{
+    for (const std::shared_ptr<Font>& Item : m_DistanceFields)
+    {
+        if (std::string(Path) == Item->Path())
+        {
+            return Item;
+        }
+    }
+
+    return nullptr;
+}
+
 std::shared_ptr<Font> Theme::GetFont() const
 {
     if (m_Fonts.empty())
@@ -109,6 +146,12 @@ void Theme::Load(const char* Path)
 }
 
 void Theme::Load(const Json& Root)
+{
+    TaskPool Pool;
+    Load(Root, Pool);
+}
+
+void Theme::Load(const Json& Root, TaskPool& Pool)
 {
     if (Root.IsString())
     {
@@ -168,11 +211,87 @@ void Theme::Load(const Json& Root)
     Set(ThemeProperties::Tree_Classic_Icons, Root["Tree_Classic_Icons"]);
     Set(ThemeProperties::Tree_Highlight_Row, Root["Tree_Highlight_Row"]);
     Set(ThemeProperties::TextEditor_InsertSpaces, Root["TextEditor_InsertSpaces"]);
+    Set(ThemeProperties::FontDistanceField, Root["FontDistanceField"]);
+    Set(ThemeProperties::AntiAliasing, Root["AntiAliasing"]);
 
     Set(ThemeProperties::FontPath, Root["FontPath"]);
 
+    // The default font is baked along with any other fonts the theme lists so that the controls
+    // using them don't need to bake them one after another when loaded.
+    const char* FontPath = m_Properties[ThemeProperties::FontPath].String();
+    const float FontSize = m_Properties[ThemeProperties::FontSize].Float();
+    std::vector<std::pair<std::string, float>> Requests { { FontPath, FontSize } };
+
+    const Json& Preload = Root["Fonts"];
+    for (unsigned int I = 0; I < Preload.Count(); I++)
+    {
+        const Json& Item = Preload[I];
+        const std::pair<std::string, float> Request { Item["Path"].String(FontPath), Item["Size"].Number(FontSize) };
+        if (std::find(Requests.begin(), Requests.end(), Request) == Requests.end())
+        {
+            Requests.push_back(Request);
+        }
+    }
+
+    // Distance field fonts only need one atlas for each font file. The requested sizes are created
+    // from these once they are uploaded.
+    const bool DistanceField = m_Properties[ThemeProperties::FontDistanceField].Bool();
+    std::vector<std::pair<std::string, std::shared_ptr<Font>>> Baking;
+    for (const std::pair<std::string, float>& Request : Requests)
+    {
+        const bool IsBaking = DistanceField && std::find_if(Baking.begin(), Baking.end(), [&Request](const std::pair<std::string, std::shared_ptr<Font>>& Item) -> bool
+            {
+                return Item.first == Request.first;
+            }) != Baking.end();
+
+        if (IsBaking)
+        {
+            continue;
+        }
+
+        std::shared_ptr<Font> NewFont = std::make_shared<Font>();
+        Baking.push_back({ Request.first, NewFont });
+        Pool.Add([NewFont, Request, DistanceField]() -> void
+            {
+                const float Size = DistanceField ? DISTANCE_FIELD_SIZE : Request.second;
+                NewFont->Bake(Request.first.c_str(), Size, { Font::BasicLatin, Font::Latin1Supplement }, DistanceField);
+            });
+    }
+
+    Pool.Wait();
+
     m_Fonts.clear();
-    GetOrAddFont(m_Properties[ThemeProperties::FontPath].String(), m_Properties[ThemeProperties::FontSize].Float());
+    m_DistanceFields.clear();
+    for (const std::pair<std::string, std::shared_ptr<Font>>& Item : Baking)
+    {
+        if (!Item.second->Upload())
+        {
+            continue;
+        }
+
+        if (DistanceField)
+        {
+            m_DistanceFields.push_back(Item.second);
+        }
+        else
+        {
+            m_Fonts.push_back(Item.second);
+        }
+    }
+
+    if (DistanceField)
+    {
+        for (const std::pair<std::string, float>& Request : Requests)
+        {
+            std::shared_ptr<Font> NewFont = Font::Create(GetDistanceField(Request.first.c_str()), Request.second);
+            if (NewFont)
+            {
+                m_Fonts.push_back(NewFont);
+            }
+        }
+    }
+
+    m_Generation++;
 
     if (m_OnThemeLoaded)
     {
@@ -185,6 +304,11 @@ const std::vector<std::shared_ptr<Font>>& Theme::Fonts() const
     return m_Fonts;
 }
 
+uint32_t Theme::Generation() const
+{
+    return m_Generation;
+}
+
 void Theme::InitializeDefault()
 {
     m_Properties[ThemeProperties::Text] = Color(255, 255, 255, 255);
@@ -239,6 +363,8 @@ void Theme::InitializeDefault()
     m_Properties[ThemeProperties::Tree_Classic_Icons] = false;
     m_Properties[ThemeProperties::Tree_Highlight_Row] = true;
     m_Properties[ThemeProperties::TextEditor_InsertSpaces] = true;
+    m_Properties[ThemeProperties::FontDistanceField] = false;
+    m_Properties[ThemeProperties::AntiAliasing] = false;
 
     m_Properties[ThemeProperties::FontPath] = "";
 }
@@ -31,6 +31,7 @@ SOFTWARE.
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace OctaneGUI
@@ -38,6 +39,7 @@ namespace OctaneGUI
 
 class Font;
 class Json;
+class TaskPool;
 
 class Theme
 {
@@ -54,15 +56,31 @@ public:
     void Load(const char* Path);
     void Load(const Json& Root);
 
+    /// @brief Loads the theme, baking its fonts on the given pool.
+    ///
+    /// Waits for the pool to finish before uploading the fonts. Any other
+    /// tasks already added to the pool are run alongside the fonts.
+    void Load(const Json& Root, TaskPool& Pool);
+
     const std::vector<std::shared_ptr<Font>>& Fonts() const;
 
+    /// @brief Incremented each time the theme is loaded.
+    ///
+    /// Anything painted with the theme's properties or fonts is stale once this changes.
+    uint32_t Generation() const;
+
 private:
     void InitializeDefault();
     void Set(ThemeProperties::Property Property, const Variant& Value);
+    std::shared_ptr<Font> GetDistanceField(const char* Path) const;
 
     std::vector<std::shared_ptr<Font>> m_Fonts;
+
+    // Atlases that the fonts are drawn from when the theme uses distance field fonts.
+    std::vector<std::shared_ptr<Font>> m_DistanceFields;
     ThemeProperties m_Properties {};
     OnEmptySignature m_OnThemeLoaded { nullptr };
+    uint32_t m_Generation { 0 };
 };
 
 }
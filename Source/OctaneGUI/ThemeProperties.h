@@ -94,6 +94,8 @@ public:
         Tree_Classic_Icons,
         Tree_Highlight_Row,
         TextEditor_InsertSpaces,
+        FontDistanceField,
+        AntiAliasing,
 
         // Strings
         FontPath,
@@ -26,8 +26,12 @@ SOFTWARE.
 
 #include "Profiler.h"
 
+#include <algorithm>
 #include <cassert>
 
+#define RECORD_CAPACITY (1 << 18)
+#define FRAME_CAPACITY (1 << 14)
+
 namespace OctaneGUI
 {
 namespace Tools
@@ -72,7 +76,7 @@ Profiler::Sample::Sample()
 {
 }
 
-Profiler::Sample::Sample(const char* Name, bool Group)
+Profiler::Sample::Sample(ID Name, bool Group)
     : m_Name(Name)
     , m_Begin(true)
     , m_Group(Group)
@@ -88,12 +92,34 @@ Profiler::Sample::~Sample()
     }
 }
 
+Profiler::NameCache::NameCache(const char* Prefix, const char* Suffix)
+    : m_Prefix(Prefix)
+    , m_Suffix(Suffix)
+{
+}
+
+Profiler::ID Profiler::NameCache::Get(const char* Key)
+{
+    for (const std::pair<std::string, ID>& Item : m_Names)
+    {
+        if (Item.first == Key)
+        {
+            return Item.second;
+        }
+    }
+
+    const std::string Name = std::string(m_Prefix) + Key + m_Suffix;
+    const ID Result = Profiler::Get().Register(Name.c_str());
+    m_Names.emplace_back(Key, Result);
+    return Result;
+}
+
 Profiler::Frame::Frame(bool Begin)
     : m_Begin(Begin)
 {
     if (Begin)
     {
-        Profiler::Get().BeginFrame();
+        Profiler::Get().BeginFrame(*this);
     }
 }
 
@@ -101,7 +127,7 @@ Profiler::Frame::~Frame()
 {
     if (m_Begin)
     {
-        Profiler::Get().EndFrame();
+        Profiler::Get().EndFrame(*this);
     }
 }
 
@@ -177,10 +203,19 @@ void Profiler::Enable()
         return;
     }
 
+    if (m_Records.empty())
+    {
+        m_Records.resize(RECORD_CAPACITY);
+        m_FrameRanges.resize(FRAME_CAPACITY);
+    }
+
     m_Enabled = true;
     m_Clock.Reset();
     m_Frames.clear();
-    m_Groups.clear();
+    m_RecordCount = 0;
+    m_FrameCount = 0;
+    m_Depth = 0;
+    m_InFrame = false;
     printf("Profiler is enabled.\n");
 }
 
@@ -192,11 +227,12 @@ void Profiler::Disable()
     }
 
     m_Enabled = false;
+    m_InFrame = false;
     float Elapsed = m_Clock.Measure();
+    BuildFrames();
     printf("Profiler has ended. Elapsed: %f\n", Elapsed);
     printf("Number of frames captured: %d\n", (int)m_Frames.size());
     printf("Coalescing samples...\n");
-    uint32_t Count = 1;
     for (Frame& Frame_ : m_Frames)
     {
         Frame_.CoalesceEvents();
@@ -214,90 +250,160 @@ const std::vector<Profiler::Frame>& Profiler::Frames() const
     return m_Frames;
 }
 
+Profiler::ID Profiler::Register(const char* Name)
+{
+    const FlyString Interned { Name };
+    for (size_t I = 0; I < m_Names.size(); I++)
+    {
+        if (m_Names[I] == Interned)
+        {
+            return (ID)I;
+        }
+    }
+
+    m_Names.push_back(Interned);
+    return (ID)(m_Names.size() - 1);
+}
+
+const char* Profiler::Name(ID Name_) const
+{
+    assert(Name_ < m_Names.size());
+    return m_Names[Name_].Data();
+}
+
 Profiler::Profiler()
 {
+    m_FrameName = Register("Frame");
 }
 
-void Profiler::BeginFrame()
+void Profiler::BeginFrame(Frame& Frame_)
 {
     if (!m_Enabled)
     {
         return;
     }
 
-    m_Frames.emplace_back(false);
-    Frame& Frame_ = m_Frames.back();
-    Frame_.m_Sample.m_Name = "Frame";
+    m_InFrame = true;
+    m_Depth = 0;
+    m_FrameRanges[m_FrameCount % m_FrameRanges.size()].first = m_RecordCount;
+    Frame_.m_Sample.m_Name = m_FrameName;
     Frame_.m_Sample.m_Group = true;
     BeginSample(Frame_.m_Sample);
 }
 
-void Profiler::EndFrame()
+void Profiler::EndFrame(Frame& Frame_)
 {
-    if (!m_Enabled || m_Frames.empty())
+    if (!m_Enabled || !m_InFrame)
     {
         return;
     }
 
-    Frame& Frame_ = m_Frames.back();
     EndSample(Frame_.m_Sample);
+    m_FrameRanges[m_FrameCount % m_FrameRanges.size()].second = m_RecordCount;
+    m_FrameCount++;
+    m_InFrame = false;
 }
 
 void Profiler::BeginSample(Sample& Sample_)
 {
-    if (!m_Enabled || m_Frames.empty())
+    if (!m_Enabled || !m_InFrame)
     {
         return;
     }
 
-    Sample_.m_Start = m_Clock.MeasureMS();
+    Record& Record_ = GetRecord(m_RecordCount);
+    Record_.Name = Sample_.m_Name;
+    Record_.Depth = m_Depth;
+    Record_.Start = m_Clock.MeasureMS();
+    Record_.Elapsed = 0;
+    Record_.Group = Sample_.m_Group;
+    Sample_.m_Record = m_RecordCount++;
 
     if (Sample_.m_Group)
     {
-        m_Groups.emplace_back(Sample_.m_Name.Data(), 0);
+        m_Depth++;
     }
 }
 
 void Profiler::EndSample(Sample& Sample_)
 {
-    if (!m_Enabled || m_Frames.empty())
+    if (!m_Enabled || !m_InFrame || Sample_.m_Record == (uint64_t)-1)
     {
         return;
     }
 
-    int64_t End = m_Clock.MeasureMS();
-    int64_t Elapsed = End - Sample_.m_Start;
-
-    Frame& Frame_ = m_Frames.back();
-
     if (Sample_.m_Group)
     {
-        m_Groups.back().m_Elapsed = Elapsed;
-
-        if (m_Groups.size() > 1)
-        {
-            Event& Dest = m_Groups[m_Groups.size() - 2];
-            Dest.m_Events.push_back(std::move(m_Groups.back()));
-        }
-        else
-        {
-            Frame_.m_Root = std::move(m_Groups.back());
-        }
+        m_Depth--;
+    }
 
-        m_Groups.pop_back();
+    // The record may have been overwritten if the frame is larger than the ring buffer.
+    if (m_RecordCount - Sample_.m_Record <= m_Records.size())
+    {
+        Record& Record_ = GetRecord(Sample_.m_Record);
+        Record_.Elapsed = m_Clock.MeasureMS() - Record_.Start;
     }
-    else
+}
+
+void Profiler::BuildFrames()
+{
+    m_Frames.clear();
+
+    const uint64_t FirstFrame = m_FrameCount > m_FrameRanges.size() ? m_FrameCount - m_FrameRanges.size() : 0;
+    const uint64_t FirstRecord = m_RecordCount > m_Records.size() ? m_RecordCount - m_Records.size() : 0;
+
+    m_Frames.reserve(m_FrameCount - FirstFrame);
+
+    std::vector<Event*> Groups;
+    for (uint64_t I = FirstFrame; I < m_FrameCount; I++)
     {
-        if (m_Groups.empty())
+        const std::pair<uint64_t, uint64_t>& Range = m_FrameRanges[I % m_FrameRanges.size()];
+        if (Range.first < FirstRecord)
         {
-            Frame_.m_Root.m_Elapsed = Elapsed;
+            continue;
         }
-        else
+
+        m_Frames.emplace_back(false);
+        Frame& Frame_ = m_Frames.back();
+        Groups.clear();
+
+        // Records are in the order samples began. A record's depth is the number of groups that
+        // were open at the time, so its parent is the last group seen at the depth above it.
+        for (uint64_t Index = Range.first; Index < Range.second; Index++)
         {
-            m_Groups.back().m_Events.emplace_back(Sample_.m_Name, Elapsed);
+            const Record& Record_ = GetRecord(Index);
+            Groups.resize(std::min<size_t>(Groups.size(), Record_.Depth));
+
+            if (Record_.Group)
+            {
+                if (Groups.empty())
+                {
+                    Frame_.m_Root = Event(m_Names[Record_.Name], Record_.Elapsed);
+                    Groups.push_back(&Frame_.m_Root);
+                }
+                else
+                {
+                    std::vector<Event>& Events = Groups.back()->m_Events;
+                    Events.emplace_back(m_Names[Record_.Name], Record_.Elapsed);
+                    Groups.push_back(&Events.back());
+                }
+            }
+            else if (Groups.empty())
+            {
+                Frame_.m_Root.m_Elapsed = Record_.Elapsed;
+            }
+            else
+            {
+                Groups.back()->m_Events.emplace_back(m_Names[Record_.Name], Record_.Elapsed);
+            }
         }
     }
 }
 
+Profiler::Record& Profiler::GetRecord(uint64_t Index)
+{
+    return m_Records[Index % m_Records.size()];
+}
+
 }
 }
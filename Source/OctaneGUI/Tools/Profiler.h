@@ -61,22 +61,43 @@ public:
         std::vector<Event> m_Events {};
     };
 
+    /// @brief Handle to an interned sample name.
+    typedef uint32_t ID;
+
     class Sample
     {
         friend Profiler;
 
     public:
         Sample();
-        Sample(const char* Name, bool Group);
+        Sample(ID Name, bool Group);
         ~Sample();
 
     private:
-        FlyString m_Name {};
-        int64_t m_Start { 0 };
+        ID m_Name { 0 };
+        uint64_t m_Record { (uint64_t)-1 };
         bool m_Begin { false };
         bool m_Group { false };
     };
 
+    /// @brief Caches sample IDs for names built from a runtime key.
+    ///
+    /// Used for names such as a class type or window title where the full
+    /// name is not known at compile time. The name is only built and
+    /// interned the first time a key is seen.
+    class NameCache
+    {
+    public:
+        NameCache(const char* Prefix, const char* Suffix);
+
+        ID Get(const char* Key);
+
+    private:
+        const char* m_Prefix { nullptr };
+        const char* m_Suffix { nullptr };
+        std::vector<std::pair<std::string, ID>> m_Names {};
+    };
+
     class Frame
     {
         friend Profiler;
@@ -107,18 +128,51 @@ public:
 
     const std::vector<Frame>& Frames() const;
 
+    /// @brief Interns a sample name and returns its ID.
+    ///
+    /// This should be called once per call site, which is what the PROFILER_SAMPLE
+    /// macros do, so that recording a sample never hashes or allocates.
+    ID Register(const char* Name);
+    const char* Name(ID Name_) const;
+
 private:
+    // A sample recorded while a frame is active. Records are written in the order samples
+    // begin and are turned into events when the profiler is disabled.
+    struct Record
+    {
+        ID Name { 0 };
+        uint32_t Depth { 0 };
+        int64_t Start { 0 };
+        int64_t Elapsed { 0 };
+        bool Group { false };
+    };
+
     Profiler();
 
-    void BeginFrame();
-    void EndFrame();
+    void BeginFrame(Frame& Frame_);
+    void EndFrame(Frame& Frame_);
 
     void BeginSample(Sample& Sample_);
     void EndSample(Sample& Sample_);
 
+    void BuildFrames();
+    Record& GetRecord(uint64_t Index);
+
     bool m_Enabled { false };
     std::vector<Frame> m_Frames {};
-    std::vector<Event> m_Groups {};
+    std::vector<FlyString> m_Names {};
+    ID m_FrameName { 0 };
+
+    // Ring buffers allocated when the profiler is enabled. Once full, the oldest frames are
+    // overwritten. No allocations are made while frames are being recorded.
+    std::vector<Record> m_Records {};
+    uint64_t m_RecordCount { 0 };
+    // First and one past the last record of each completed frame.
+    std::vector<std::pair<uint64_t, uint64_t>> m_FrameRanges {};
+    uint64_t m_FrameCount { 0 };
+    uint32_t m_Depth { 0 };
+    bool m_InFrame { false };
+
     Clock m_Clock {};
 };
 
@@ -55,10 +55,6 @@ Vector2 Vector2::FromJson(const Json& Value, const Vector2& Default)
     return Result;
 }
 
-Vector2::Vector2()
-{
-}
-
 Vector2::Vector2(float InX, float InY)
     : X(InX)
     , Y(InY)
@@ -41,7 +41,7 @@ public:
     float X { 0.0f };
     float Y { 0.0f };
 
-    Vector2();
+    Vector2() {}
     Vector2(float InX, float InY);
 
     Vector2 operator-() const;
@@ -29,13 +29,6 @@ SOFTWARE.
 namespace OctaneGUI
 {
 
-Vertex::Vertex()
-    : Position()
-    , TexCoords()
-    , Col()
-{
-}
-
 Vertex::Vertex(const Vector2& InPosition)
     : Position(InPosition)
     , TexCoords()
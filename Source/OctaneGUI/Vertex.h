@@ -39,7 +39,7 @@ public:
     Vector2 TexCoords;
     Color Col;
 
-    Vertex();
+    Vertex() = default;
     Vertex(const Vector2& InPosition);
     Vertex(const Vector2& InPosition, const Color& InCol);
     Vertex(const Vector2& InPosition, const Vector2& InTexCoords, const Color& InCol);
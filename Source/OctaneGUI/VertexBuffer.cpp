@@ -25,10 +25,49 @@ SOFTWARE.
 */
 
 #include "VertexBuffer.h"
+#include "Rect.h"
+
+#include <algorithm>
+#include <cfloat>
+
+// SSE2 is part of every x86-64 target and NEON of every AArch64 target, so no runtime detection
+// is needed. Define NO_SIMD to build only the scalar path.
+#if !defined(NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64))
+    #define SIMD_SSE
+    #include <emmintrin.h>
+#elif !defined(NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #define SIMD_NEON
+    #include <arm_neon.h>
+#endif
 
 namespace OctaneGUI
 {
 
+// The SIMD paths load a rect as four floats and store a position and texture coordinate pair
+// as four floats.
+static_assert(sizeof(Rect) == sizeof(float) * 4, "Rect must be four packed floats.");
+static_assert(offsetof(Vertex, TexCoords) == offsetof(Vertex, Position) + sizeof(float) * 2, "Vertex position and texture coordinates must be adjacent.");
+
+#if defined(SIMD_SSE) || defined(SIMD_NEON)
+bool VertexBuffer::s_SIMD = true;
+#else
+bool VertexBuffer::s_SIMD = false;
+#endif
+
+void VertexBuffer::SetSIMD(bool Enabled)
+{
+#if defined(SIMD_SSE) || defined(SIMD_NEON)
+    s_SIMD = Enabled;
+#else
+    (void)Enabled;
+#endif
+}
+
+bool VertexBuffer::SIMD()
+{
+    return s_SIMD;
+}
+
 VertexBuffer::VertexBuffer()
 {
 }
@@ -39,16 +78,20 @@ VertexBuffer::~VertexBuffer()
 
 void VertexBuffer::AddVertex(const Vector2& Point, const Color& Col)
 {
+    CheckGrowth(m_Vertices, 1);
     m_Vertices.emplace_back(Point, Col);
 }
 
 void VertexBuffer::AddVertex(const Vector2& Point, const Vector2& TexCoords, const Color& Col)
 {
+    CheckGrowth(m_Vertices, 1);
     m_Vertices.emplace_back(Point, TexCoords, Col);
 }
 
 void VertexBuffer::AddVertices(const std::vector<Vector2>& Points, const Color& Col)
 {
+    CheckGrowth(m_Vertices, Points.size());
+
     const size_t Index = m_Vertices.size();
     m_Vertices.resize(m_Vertices.size() + Points.size());
 
@@ -61,7 +104,18 @@ void VertexBuffer::AddVertices(const std::vector<Vector2>& Points, const Color&
 
 void VertexBuffer::AddIndex(uint32_t Index)
 {
-    m_Indices.push_back(Index);
+    CheckGrowth(m_Indices, 1);
+    m_Indices.push_back(Index + m_IndexBias);
+}
+
+void VertexBuffer::AddQuads(const Rect* Vertices, const Rect* TexCoords, const Color* Colors, uint32_t Count, const Vector2& Offset)
+{
+    EmitQuads(Vertices, TexCoords, Colors, 1, Count, Offset);
+}
+
+void VertexBuffer::AddQuads(const Rect* Vertices, const Rect* TexCoords, const Color& Col, uint32_t Count, const Vector2& Offset)
+{
+    EmitQuads(Vertices, TexCoords, &Col, 0, Count, Offset);
 }
 
 const std::vector<Vertex>& VertexBuffer::GetVertices() const
@@ -84,9 +138,33 @@ uint32_t VertexBuffer::GetIndexCount() const
     return m_Indices.size();
 }
 
-DrawCommand& VertexBuffer::PushCommand(uint32_t IndexCount, uint32_t TextureID, Rect Clip)
+DrawCommand& VertexBuffer::PushCommand(uint32_t IndexCount, uint32_t TextureID, Rect Clip, bool DistanceField)
 {
-    m_Commands.emplace_back((uint32_t)m_Vertices.size(), (uint32_t)m_Indices.size(), IndexCount, TextureID, Clip);
+    m_SubmittedCommands++;
+
+    const bool BreakBatch = m_BreakBatch;
+    m_BreakBatch = false;
+
+    if (!BreakBatch && !m_Commands.empty())
+    {
+        const DrawCommand& Last = m_Commands.back();
+
+        // Only merge when the previous command received exactly the indices it asked for. Otherwise
+        // the indices being added next would not line up with the merged range.
+        if (Last.TextureID() == TextureID
+            && Last.DistanceField() == DistanceField
+            && Last.Clip() == Clip
+            && Last.IndexOffset() + Last.IndexCount() == (uint32_t)m_Indices.size())
+        {
+            m_IndexBias = (uint32_t)m_Vertices.size() - Last.VertexOffset();
+            m_Commands.back() = DrawCommand(Last.VertexOffset(), Last.IndexOffset(), Last.IndexCount() + IndexCount, TextureID, Clip, DistanceField);
+            return m_Commands.back();
+        }
+    }
+
+    m_IndexBias = 0;
+    CheckGrowth(m_Commands, 1);
+    m_Commands.emplace_back((uint32_t)m_Vertices.size(), (uint32_t)m_Indices.size(), IndexCount, TextureID, Clip, DistanceField);
     return m_Commands.back();
 }
 
@@ -95,4 +173,359 @@ const std::vector<DrawCommand>& VertexBuffer::Commands() const
     return m_Commands;
 }
 
+void VertexBuffer::BreakBatch()
+{
+    m_BreakBatch = true;
+}
+
+void VertexBuffer::SortByTexture()
+{
+    if (m_Commands.size() < 2)
+    {
+        return;
+    }
+
+    struct Batch
+    {
+    public:
+        uint32_t TextureID { 0 };
+        bool DistanceField { false };
+        Rect Clip {};
+        Rect Bounds {};
+        uint32_t IndexCount { 0 };
+    };
+
+    // Limits how far back a command will search for a batch to join.
+    const size_t MaxLookBehind = 64;
+
+    std::vector<Batch> Batches;
+    std::vector<uint32_t> Assignments(m_Commands.size(), 0);
+
+    for (size_t I = 0; I < m_Commands.size(); I++)
+    {
+        const DrawCommand& Command = m_Commands[I];
+
+        Rect Bounds { Vector2(FLT_MAX, FLT_MAX), Vector2(-FLT_MAX, -FLT_MAX) };
+        for (uint32_t J = 0; J < Command.IndexCount(); J++)
+        {
+            const Vector2& Position = m_Vertices[m_Indices[Command.IndexOffset() + J] + Command.VertexOffset()].Position;
+            Bounds.Min.X = std::min<float>(Bounds.Min.X, Position.X);
+            Bounds.Min.Y = std::min<float>(Bounds.Min.Y, Position.Y);
+            Bounds.Max.X = std::max<float>(Bounds.Max.X, Position.X);
+            Bounds.Max.Y = std::max<float>(Bounds.Max.Y, Position.Y);
+        }
+
+        if (!Command.Clip().IsZero())
+        {
+            Bounds = Bounds.Intersection(Command.Clip());
+        }
+
+        // Walk back through the batches until one can be joined or one is painted underneath
+        // this command, in which case this command must stay after it.
+        size_t Target = Batches.size();
+        const size_t Stop = Batches.size() > MaxLookBehind ? Batches.size() - MaxLookBehind : 0;
+        for (size_t J = Batches.size(); J > Stop; J--)
+        {
+            const Batch& Item = Batches[J - 1];
+
+            if (Item.TextureID == Command.TextureID() && Item.DistanceField == Command.DistanceField() && Item.Clip == Command.Clip())
+            {
+                Target = J - 1;
+                break;
+            }
+
+            if (Item.Bounds.Intersects(Bounds))
+            {
+                break;
+            }
+        }
+
+        if (Target == Batches.size())
+        {
+            Batches.push_back({ Command.TextureID(), Command.DistanceField(), Command.Clip(), Bounds, 0 });
+        }
+        else
+        {
+            Batch& Item = Batches[Target];
+            Item.Bounds.Min.X = std::min<float>(Item.Bounds.Min.X, Bounds.Min.X);
+            Item.Bounds.Min.Y = std::min<float>(Item.Bounds.Min.Y, Bounds.Min.Y);
+            Item.Bounds.Max.X = std::max<float>(Item.Bounds.Max.X, Bounds.Max.X);
+            Item.Bounds.Max.Y = std::max<float>(Item.Bounds.Max.Y, Bounds.Max.Y);
+        }
+
+        Batches[Target].IndexCount += Command.IndexCount();
+        Assignments[I] = (uint32_t)Target;
+    }
+
+    if (Batches.size() == m_Commands.size())
+    {
+        return;
+    }
+
+    std::vector<uint32_t> Offsets(Batches.size(), 0);
+    uint32_t IndexOffset = 0;
+    for (size_t I = 0; I < Batches.size(); I++)
+    {
+        Offsets[I] = IndexOffset;
+        IndexOffset += Batches[I].IndexCount;
+    }
+
+    std::vector<uint32_t> Indices(IndexOffset, 0);
+    for (size_t I = 0; I < m_Commands.size(); I++)
+    {
+        const DrawCommand& Command = m_Commands[I];
+        uint32_t& Offset = Offsets[Assignments[I]];
+
+        for (uint32_t J = 0; J < Command.IndexCount(); J++)
+        {
+            Indices[Offset++] = m_Indices[Command.IndexOffset() + J] + Command.VertexOffset();
+        }
+    }
+
+    m_Commands.clear();
+    IndexOffset = 0;
+    for (const Batch& Item : Batches)
+    {
+        m_Commands.emplace_back(0, IndexOffset, Item.IndexCount, Item.TextureID, Item.Clip, Item.DistanceField);
+        IndexOffset += Item.IndexCount;
+    }
+
+    m_Indices.swap(Indices);
+    m_IndexBias = 0;
+}
+
+void VertexBuffer::EmitQuads(const Rect* Vertices, const Rect* TexCoords, const Color* Colors, size_t ColorStride, uint32_t Count, const Vector2& Offset)
+{
+    if (Count == 0)
+    {
+        return;
+    }
+
+    CheckGrowth(m_Vertices, (size_t)Count * 4);
+    CheckGrowth(m_Indices, (size_t)Count * 6);
+
+    const size_t VertexStart = m_Vertices.size();
+    const size_t IndexStart = m_Indices.size();
+    m_Vertices.resize(VertexStart + (size_t)Count * 4);
+    m_Indices.resize(IndexStart + (size_t)Count * 6);
+
+    // Same value AddIndex would produce for the first vertex added here.
+    const uint32_t Base = (uint32_t)VertexStart - (m_Commands.empty() ? 0 : m_Commands.back().VertexOffset());
+
+    Vertex* Out = &m_Vertices[VertexStart];
+    uint32_t* OutIndices = &m_Indices[IndexStart];
+    uint32_t Quad = 0;
+
+#if defined(SIMD_SSE)
+    if (s_SIMD)
+    {
+        // Each vertex is a shuffle of the rect's min and max with the matching texture coordinates.
+        const __m128 Translate = _mm_setr_ps(Offset.X, Offset.Y, Offset.X, Offset.Y);
+        for (uint32_t I = 0; I < Count; I++)
+        {
+            const __m128 Bounds = _mm_add_ps(_mm_loadu_ps(&Vertices[I].Min.X), Translate);
+            const __m128 UVs = _mm_loadu_ps(&TexCoords[I].Min.X);
+            const Color& Col = Colors[I * ColorStride];
+
+            Vertex* Corners = Out + (size_t)I * 4;
+            _mm_storeu_ps(&Corners[0].Position.X, _mm_shuffle_ps(Bounds, UVs, _MM_SHUFFLE(1, 0, 1, 0)));
+            _mm_storeu_ps(&Corners[1].Position.X, _mm_shuffle_ps(Bounds, UVs, _MM_SHUFFLE(1, 2, 1, 2)));
+            _mm_storeu_ps(&Corners[2].Position.X, _mm_shuffle_ps(Bounds, UVs, _MM_SHUFFLE(3, 2, 3, 2)));
+            _mm_storeu_ps(&Corners[3].Position.X, _mm_shuffle_ps(Bounds, UVs, _MM_SHUFFLE(3, 0, 3, 0)));
+            Corners[0].Col = Col;
+            Corners[1].Col = Col;
+            Corners[2].Col = Col;
+            Corners[3].Col = Col;
+        }
+
+        // Two quads produce twelve indices, which is three full registers.
+        const __m128i Step = _mm_set1_epi32(8);
+        __m128i First = _mm_add_epi32(_mm_setr_epi32(0, 1, 2, 0), _mm_set1_epi32((int)Base));
+        __m128i Second = _mm_add_epi32(_mm_setr_epi32(2, 3, 4, 5), _mm_set1_epi32((int)Base));
+        __m128i Third = _mm_add_epi32(_mm_setr_epi32(6, 4, 6, 7), _mm_set1_epi32((int)Base));
+        for (; Quad + 2 <= Count; Quad += 2)
+        {
+            uint32_t* Dst = OutIndices + (size_t)Quad * 6;
+            _mm_storeu_si128((__m128i*)Dst, First);
+            _mm_storeu_si128((__m128i*)(Dst + 4), Second);
+            _mm_storeu_si128((__m128i*)(Dst + 8), Third);
+            First = _mm_add_epi32(First, Step);
+            Second = _mm_add_epi32(Second, Step);
+            Third = _mm_add_epi32(Third, Step);
+        }
+    }
+    else
+#elif defined(SIMD_NEON)
+    if (s_SIMD)
+    {
+        const float TranslateValues[4] = { Offset.X, Offset.Y, Offset.X, Offset.Y };
+        const float32x4_t Translate = vld1q_f32(TranslateValues);
+        for (uint32_t I = 0; I < Count; I++)
+        {
+            const float32x4_t Bounds = vaddq_f32(vld1q_f32(&Vertices[I].Min.X), Translate);
+            const float32x4_t UVs = vld1q_f32(&TexCoords[I].Min.X);
+            const Color& Col = Colors[I * ColorStride];
+
+            // The first and third vertices are the low and high halves. The others swap in the X values.
+            const float32x4_t TopLeft = vcombine_f32(vget_low_f32(Bounds), vget_low_f32(UVs));
+            const float32x4_t BottomRight = vcombine_f32(vget_high_f32(Bounds), vget_high_f32(UVs));
+            const float32x4_t TopRight = vsetq_lane_f32(vgetq_lane_f32(UVs, 2), vsetq_lane_f32(vgetq_lane_f32(Bounds, 2), TopLeft, 0), 2);
+            const float32x4_t BottomLeft = vsetq_lane_f32(vgetq_lane_f32(UVs, 0), vsetq_lane_f32(vgetq_lane_f32(Bounds, 0), BottomRight, 0), 2);
+
+            Vertex* Corners = Out + (size_t)I * 4;
+            vst1q_f32(&Corners[0].Position.X, TopLeft);
+            vst1q_f32(&Corners[1].Position.X, TopRight);
+            vst1q_f32(&Corners[2].Position.X, BottomRight);
+            vst1q_f32(&Corners[3].Position.X, BottomLeft);
+            Corners[0].Col = Col;
+            Corners[1].Col = Col;
+            Corners[2].Col = Col;
+            Corners[3].Col = Col;
+        }
+
+        static const uint32_t Pattern[12] = { 0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7 };
+        const uint32x4_t Step = vdupq_n_u32(8);
+        uint32x4_t First = vaddq_u32(vld1q_u32(Pattern), vdupq_n_u32(Base));
+        uint32x4_t Second = vaddq_u32(vld1q_u32(Pattern + 4), vdupq_n_u32(Base));
+        uint32x4_t Third = vaddq_u32(vld1q_u32(Pattern + 8), vdupq_n_u32(Base));
+        for (; Quad + 2 <= Count; Quad += 2)
+        {
+            uint32_t* Dst = OutIndices + (size_t)Quad * 6;
+            vst1q_u32(Dst, First);
+            vst1q_u32(Dst + 4, Second);
+            vst1q_u32(Dst + 8, Third);
+            First = vaddq_u32(First, Step);
+            Second = vaddq_u32(Second, Step);
+            Third = vaddq_u32(Third, Step);
+        }
+    }
+    else
+#endif
+    {
+        for (uint32_t I = 0; I < Count; I++)
+        {
+            const Rect& Bounds = Vertices[I];
+            const Rect& UVs = TexCoords[I];
+            const Color& Col = Colors[I * ColorStride];
+
+            Vertex* Corners = Out + (size_t)I * 4;
+            Corners[0].Position = Bounds.Min + Offset;
+            Corners[0].TexCoords = UVs.Min;
+            Corners[1].Position = Vector2(Bounds.Max.X, Bounds.Min.Y) + Offset;
+            Corners[1].TexCoords = Vector2(UVs.Max.X, UVs.Min.Y);
+            Corners[2].Position = Bounds.Max + Offset;
+            Corners[2].TexCoords = UVs.Max;
+            Corners[3].Position = Vector2(Bounds.Min.X, Bounds.Max.Y) + Offset;
+            Corners[3].TexCoords = Vector2(UVs.Min.X, UVs.Max.Y);
+            Corners[0].Col = Col;
+            Corners[1].Col = Col;
+            Corners[2].Col = Col;
+            Corners[3].Col = Col;
+        }
+    }
+
+    // Any quads the SIMD paths did not write indices for.
+    for (; Quad < Count; Quad++)
+    {
+        const uint32_t Index = Base + Quad * 4;
+        uint32_t* Dst = OutIndices + (size_t)Quad * 6;
+        Dst[0] = Index;
+        Dst[1] = Index + 1;
+        Dst[2] = Index + 2;
+        Dst[3] = Index;
+        Dst[4] = Index + 2;
+        Dst[5] = Index + 3;
+    }
+}
+
+uint32_t VertexBuffer::SubmittedCommands() const
+{
+    return m_SubmittedCommands;
+}
+
+float VertexBuffer::BatchRatio() const
+{
+    if (m_Commands.empty())
+    {
+        return 1.0f;
+    }
+
+    return (float)m_SubmittedCommands / (float)m_Commands.size();
+}
+
+void VertexBuffer::Append(const VertexBuffer& Source, uint32_t VertexStart, uint32_t IndexStart, uint32_t CommandStart)
+{
+    const uint32_t BaseVertex = (uint32_t)m_Vertices.size();
+    const uint32_t BaseIndex = (uint32_t)m_Indices.size();
+
+    CheckGrowth(m_Vertices, Source.m_Vertices.size() - VertexStart);
+    CheckGrowth(m_Indices, Source.m_Indices.size() - IndexStart);
+    CheckGrowth(m_Commands, Source.m_Commands.size() - CommandStart);
+
+    // Indices are relative to each command's vertex offset so they can be copied as is.
+    m_Vertices.insert(m_Vertices.end(), Source.m_Vertices.begin() + VertexStart, Source.m_Vertices.end());
+    m_Indices.insert(m_Indices.end(), Source.m_Indices.begin() + IndexStart, Source.m_Indices.end());
+
+    m_IndexBias = 0;
+    m_BreakBatch = false;
+    m_SubmittedCommands += (uint32_t)(Source.m_Commands.size() - CommandStart);
+
+    for (size_t I = CommandStart; I < Source.m_Commands.size(); I++)
+    {
+        const DrawCommand& Command = Source.m_Commands[I];
+        m_Commands.emplace_back(
+            Command.VertexOffset() - VertexStart + BaseVertex,
+            Command.IndexOffset() - IndexStart + BaseIndex,
+            Command.IndexCount(),
+            Command.TextureID(),
+            Command.Clip(),
+            Command.DistanceField());
+    }
+}
+
+void VertexBuffer::Clear()
+{
+    m_VertexHighWaterMark = std::max<uint32_t>(m_VertexHighWaterMark, (uint32_t)m_Vertices.size());
+    m_IndexHighWaterMark = std::max<uint32_t>(m_IndexHighWaterMark, (uint32_t)m_Indices.size());
+    m_CommandHighWaterMark = std::max<uint32_t>(m_CommandHighWaterMark, (uint32_t)m_Commands.size());
+
+    // std::vector::clear does not release the allocated memory, so the next frame will
+    // be able to fill up to the high-water marks without reallocating.
+    m_Vertices.clear();
+    m_Indices.clear();
+    m_Commands.clear();
+    m_IndexBias = 0;
+    m_BreakBatch = false;
+    m_SubmittedCommands = 0;
+    m_AllocationCount = 0;
+}
+
+VertexBuffer& VertexBuffer::Reserve(uint32_t VertexCount, uint32_t IndexCount, uint32_t CommandCount)
+{
+    m_Vertices.reserve(VertexCount);
+    m_Indices.reserve(IndexCount);
+    m_Commands.reserve(CommandCount);
+    return *this;
+}
+
+uint32_t VertexBuffer::AllocationCount() const
+{
+    return m_AllocationCount;
+}
+
+uint32_t VertexBuffer::VertexHighWaterMark() const
+{
+    return std::max<uint32_t>(m_VertexHighWaterMark, (uint32_t)m_Vertices.size());
+}
+
+uint32_t VertexBuffer::IndexHighWaterMark() const
+{
+    return std::max<uint32_t>(m_IndexHighWaterMark, (uint32_t)m_Indices.size());
+}
+
+uint32_t VertexBuffer::CommandHighWaterMark() const
+{
+    return std::max<uint32_t>(m_CommandHighWaterMark, (uint32_t)m_Commands.size());
+}
+
 }
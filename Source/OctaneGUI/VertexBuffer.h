@@ -29,14 +29,25 @@ SOFTWARE.
 #include "DrawCommand.h"
 #include "Vertex.h"
 
+#include <cstddef>
 #include <vector>
 
 namespace OctaneGUI
 {
 
+struct Rect;
+
 class VertexBuffer
 {
 public:
+    /// @brief Enables the SSE or NEON paths of AddQuads when the build supports them.
+    ///
+    /// Enabled by default. Disabling this uses the scalar path, which produces the same results.
+    static void SetSIMD(bool Enabled);
+
+    /// @brief Whether AddQuads is using a SIMD path.
+    static bool SIMD();
+
     VertexBuffer();
     ~VertexBuffer();
 
@@ -45,19 +56,119 @@ public:
     void AddVertices(const std::vector<Vector2>& Points, const Color& Tint);
     void AddIndex(uint32_t Index);
 
+    /// @brief Adds a textured quad for each rectangle, four vertices and six indices each.
+    ///
+    /// Storage grows once for the whole batch and the vertices are written directly instead of
+    /// through AddVertex and AddIndex. The indices are relative to the first vertex of the last
+    /// command, matching those added with AddIndex after a call to PushCommand.
+    ///
+    /// @param Vertices Bounds of each quad.
+    /// @param TexCoords Texture coordinates of each quad.
+    /// @param Colors Color of each quad.
+    /// @param Count Number of quads.
+    /// @param Offset Added to the bounds of every quad.
+    void AddQuads(const Rect* Vertices, const Rect* TexCoords, const Color* Colors, uint32_t Count, const Vector2& Offset = {});
+
+    /// @brief Adds textured quads that all share the same color.
+    void AddQuads(const Rect* Vertices, const Rect* TexCoords, const Color& Col, uint32_t Count, const Vector2& Offset = {});
+
     const std::vector<Vertex>& GetVertices() const;
     const std::vector<uint32_t>& GetIndices() const;
 
     uint32_t GetVertexCount() const;
     uint32_t GetIndexCount() const;
 
-    DrawCommand& PushCommand(uint32_t IndexCount, uint32_t TextureID, Rect Clip);
+    /// @brief Begins a new draw for the given number of indices.
+    ///
+    /// If the previous command uses the same texture and clip, the indices are appended to
+    /// that command instead of starting a new one. Indices added afterwards are rebased so
+    /// they can still be relative to the vertices added after this call.
+    ///
+    /// @param IndexCount Number of indices that will be added for this draw.
+    /// @param TextureID Texture to sample from. 0 uses the default white texture.
+    /// @param Clip Clipping rectangle. A zero rectangle means no clipping.
+    /// @param DistanceField The texture holds signed distance fields.
+    /// @return The command the indices will be drawn with.
+    DrawCommand& PushCommand(uint32_t IndexCount, uint32_t TextureID, Rect Clip, bool DistanceField = false);
     const std::vector<DrawCommand>& Commands() const;
 
+    /// @brief Prevents the next PushCommand from being merged into the current last command.
+    ///
+    /// Used when a range of commands needs to be captured on its own.
+    void BreakBatch();
+
+    /// @brief Reorders commands so that those sharing a texture and clip can be drawn together.
+    ///
+    /// A command is only moved earlier if it does not overlap any command it would be moved
+    /// in front of, so the painted result is the same. The indices of merged commands are
+    /// rewritten to be relative to the first vertex of the buffer.
+    void SortByTexture();
+
+    /// @brief Number of PushCommand calls since the last Clear.
+    uint32_t SubmittedCommands() const;
+
+    /// @brief Ratio of submitted draws to the number of commands that will be issued.
+    ///
+    /// A value of 1 means no draws were merged.
+    float BatchRatio() const;
+
+    /// @brief Copies the contents of another buffer to the end of this buffer.
+    ///
+    /// Only the vertices, indices, and commands starting at the given offsets are copied.
+    /// The offsets of each copied command are rebased to point into this buffer.
+    ///
+    /// @param Source The buffer to copy from.
+    /// @param VertexStart First vertex in the source buffer to copy.
+    /// @param IndexStart First index in the source buffer to copy.
+    /// @param CommandStart First command in the source buffer to copy.
+    void Append(const VertexBuffer& Source, uint32_t VertexStart = 0, uint32_t IndexStart = 0, uint32_t CommandStart = 0);
+
+    /// @brief Removes all vertices, indices, and commands while keeping the allocated memory.
+    ///
+    /// The high-water marks are updated with the current counts before clearing so that the
+    /// buffer can be reused for the next frame without growing from zero again.
+    void Clear();
+
+    /// @brief Ensures the buffer can hold at least the given counts without reallocating.
+    /// @param VertexCount Number of vertices to reserve.
+    /// @param IndexCount Number of indices to reserve.
+    /// @param CommandCount Number of draw commands to reserve.
+    /// @return This VertexBuffer reference.
+    VertexBuffer& Reserve(uint32_t VertexCount, uint32_t IndexCount, uint32_t CommandCount);
+
+    /// @brief Number of times the vertex, index, or command storage had to grow since the last Clear.
+    uint32_t AllocationCount() const;
+
+    uint32_t VertexHighWaterMark() const;
+    uint32_t IndexHighWaterMark() const;
+    uint32_t CommandHighWaterMark() const;
+
 private:
+    static bool s_SIMD;
+
+    void EmitQuads(const Rect* Vertices, const Rect* TexCoords, const Color* Colors, size_t ColorStride, uint32_t Count, const Vector2& Offset);
+
+    template <typename T>
+    void CheckGrowth(const std::vector<T>& Items, size_t Count)
+    {
+        if (Items.size() + Count > Items.capacity())
+        {
+            m_AllocationCount++;
+        }
+    }
+
     std::vector<Vertex> m_Vertices;
     std::vector<uint32_t> m_Indices;
     std::vector<DrawCommand> m_Commands;
+
+    uint32_t m_IndexBias { 0 };
+    bool m_BreakBatch { false };
+    uint32_t m_SubmittedCommands { 0 };
+
+    uint32_t m_AllocationCount { 0 };
+    uint32_t m_VertexHighWaterMark { 0 };
+    uint32_t m_IndexHighWaterMark { 0 };
+    uint32_t m_CommandHighWaterMark { 0 };
 };
 
 }
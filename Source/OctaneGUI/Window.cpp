@@ -30,6 +30,7 @@ SOFTWARE.
 #include "Controls/MenuBar.h"
 #include "Controls/MenuItem.h"
 #include "Controls/WindowContainer.h"
+#include "Font.h"
 #include "Json.h"
 #include "Paint.h"
 #include "Profiler.h"
@@ -40,6 +41,7 @@ SOFTWARE.
 #endif
 
 #include <algorithm>
+#include <cmath>
 
 namespace OctaneGUI
 {
@@ -49,12 +51,7 @@ Window::Window(Application* InApplication)
 {
     m_Popup.SetOnInvalidate([=](std::shared_ptr<Control> Focus, InvalidateType Type) -> void
         {
-            if ((Type == InvalidateType::Layout || Type == InvalidateType::Both))
-            {
-                RequestLayout(std::dynamic_pointer_cast<Container>(Focus));
-            }
-
-            m_Repaint = true;
+            OnInvalidate(Focus, Type);
         });
 
     m_Popup.SetOnClose([=](const Container& Focus) -> void
@@ -67,6 +64,7 @@ Window::Window(Application* InApplication)
 
             m_Container->CloseMenuBar();
             m_Repaint = true;
+            m_DamageAll = true;
         });
 }
 
@@ -213,6 +211,7 @@ Window& Window::SetVisible(bool Visible)
 {
     m_Visible = Visible;
     m_Repaint = Visible;
+    m_DamageAll = true;
     if (m_Visible)
     {
         SetCustomTitleBar(CustomTitleBar());
@@ -354,6 +353,17 @@ bool Window::CustomTitleBar() const
     return !(m_Flags & WindowFlags::TitleBar);
 }
 
+Window& Window::SetSortCommands(bool SortCommands)
+{
+    m_SortCommands = SortCommands;
+    return *this;
+}
+
+bool Window::SortCommands() const
+{
+    return m_SortCommands;
+}
+
 Window& Window::SetFlags(uint64_t Flags)
 {
     m_Flags = m_Flags | Flags;
@@ -601,15 +611,11 @@ void Window::CreateContainer()
     m_Container
         ->SetOnInvalidate([=](std::shared_ptr<Control> Focus, InvalidateType Type) -> void
             {
-                if ((Type == InvalidateType::Layout || Type == InvalidateType::Both))
-                {
-                    RequestLayout(std::dynamic_pointer_cast<Container>(Focus));
-                }
-
-                m_Repaint = true;
+                OnInvalidate(Focus, Type);
             });
 
     m_Repaint = true;
+    m_DamageAll = true;
 }
 
 std::shared_ptr<Container> Window::GetContainer() const
@@ -671,7 +677,7 @@ Mouse::Cursor Window::MouseCursor() const
 
 void Window::Update()
 {
-    PROFILER_SAMPLE_GROUP((std::string("Window::Update (") + GetTitle() + ")").c_str());
+    PROFILER_SAMPLE_GROUP_KEY("Window::Update (", GetTitle(), ")");
 
     UpdateTimers();
 
@@ -696,19 +702,56 @@ void Window::Update()
     m_Popup.Update();
 }
 
-void Window::DoPaint(Paint& Brush)
+void Window::DoPaint()
 {
     if (m_Repaint)
     {
-        PROFILER_SAMPLE_GROUP((std::string("Window::OnPaint (") + GetTitle() + ")").c_str());
+        PROFILER_SAMPLE_GROUP_KEY("Window::OnPaint (", GetTitle(), ")");
+
+        const bool Partial = m_OnPaintRegion && !m_DamageAll && !m_Damage.empty();
+
+        m_Buffer.Clear();
+        Paint Brush(m_Buffer, GetTheme());
+
+        if (Partial)
+        {
+            Brush.SetDamage(m_Damage);
+        }
 
         m_Container->OnPaint(Brush);
         m_Popup.OnPaint(Brush);
         m_Repaint = false;
-        m_OnPaint(this, Brush.GetBuffer());
+
+        if (m_SortCommands)
+        {
+            m_Buffer.SortByTexture();
+        }
+
+        if (Partial)
+        {
+            m_OnPaintRegion(this, m_Buffer, m_Damage);
+        }
+        else
+        {
+            m_OnPaint(this, m_Buffer);
+        }
+
+        m_Damage.clear();
+        m_DamageAll = false;
+        Font::NextFrame();
     }
 }
 
+VertexBuffer& Window::GetBuffer()
+{
+    return m_Buffer;
+}
+
+const VertexBuffer& Window::GetBuffer() const
+{
+    return m_Buffer;
+}
+
 void Window::Load(const char* JsonStream)
 {
     Load(Json::Parse(JsonStream));
@@ -743,6 +786,7 @@ void Window::LoadRoot(const Json& Root)
     SetResizable(Root["Resizable"].Boolean(IsResizable()));
     SetCanMinimize(Root["CanMinimize"].Boolean(CanMinimize()));
     SetCustomTitleBar(Root["CustomTitleBar"].Boolean(CustomTitleBar()));
+    SetSortCommands(Root["SortCommands"].Boolean(SortCommands()));
 
     if (Root["Modal"].Boolean(Modal()))
     {
@@ -818,12 +862,44 @@ bool Window::ClearTimer(const std::shared_ptr<Timer>& Object)
     return false;
 }
 
+int Window::NextTimerTimeout() const
+{
+    int Result = -1;
+
+    for (const TimerHandle& Handle : m_Timers)
+    {
+        if (Handle.Object.expired())
+        {
+            continue;
+        }
+
+        const int64_t Remaining = std::max<int64_t>((int64_t)Handle.Object.lock()->Interval() - Handle.Elapsed.MeasureMS(), 0);
+        if (Result < 0 || Remaining < (int64_t)Result)
+        {
+            Result = (int)Remaining;
+        }
+    }
+
+    return Result;
+}
+
+bool Window::HasPendingWork() const
+{
+    return !m_LayoutRequests.empty() || m_Repaint;
+}
+
 Window& Window::SetOnPaint(OnPaintSignature&& Fn)
 {
     m_OnPaint = std::move(Fn);
     return *this;
 }
 
+Window& Window::SetOnPaintRegion(OnPaintRegionSignature&& Fn)
+{
+    m_OnPaintRegion = std::move(Fn);
+    return *this;
+}
+
 Window& Window::SetOnSetTitle(OnSetTitleSignature&& Fn)
 {
     m_OnSetTitle = std::move(Fn);
@@ -875,6 +951,82 @@ void Window::Populate(ControlList& List) const
     m_Container->GetControlList(List);
 }
 
+void Window::OnInvalidate(const std::shared_ptr<Control>& Focus, InvalidateType Type)
+{
+    if ((Type == InvalidateType::Layout || Type == InvalidateType::Both))
+    {
+        RequestLayout(std::dynamic_pointer_cast<Container>(Focus));
+
+        // Controls may move anywhere after a layout so the whole window needs to be repainted.
+        m_DamageAll = true;
+    }
+    else if (Focus)
+    {
+        AddDamage(Focus->GetAbsoluteBounds());
+    }
+    else
+    {
+        m_DamageAll = true;
+    }
+
+    m_Repaint = true;
+}
+
+void Window::AddDamage(const Rect& Bounds)
+{
+    // Past this many regions it is cheaper to just repaint the whole window.
+    const size_t MaxDamageRegions = 16;
+
+    if (m_DamageAll)
+    {
+        return;
+    }
+
+    // Frontends paint every command once per region, so the regions must never overlap or the
+    // overlapping pixels would be blended twice. Overlapping regions are merged into their union,
+    // which may then overlap regions that were checked before, so the search starts over.
+    // Frontends clip to whole pixels, so the region is rounded outward to include any pixel
+    // that is only partially covered.
+    Rect Merged = {
+        std::floor(Bounds.Min.X),
+        std::floor(Bounds.Min.Y),
+        std::ceil(Bounds.Max.X),
+        std::ceil(Bounds.Max.Y)
+    };
+    for (std::vector<Rect>::iterator It = m_Damage.begin(); It != m_Damage.end();)
+    {
+        if (It->Encompasses(Merged))
+        {
+            return;
+        }
+
+        if (It->Intersects(Merged))
+        {
+            Merged = {
+                std::min<float>(Merged.Min.X, It->Min.X),
+                std::min<float>(Merged.Min.Y, It->Min.Y),
+                std::max<float>(Merged.Max.X, It->Max.X),
+                std::max<float>(Merged.Max.Y, It->Max.Y)
+            };
+            m_Damage.erase(It);
+            It = m_Damage.begin();
+        }
+        else
+        {
+            ++It;
+        }
+    }
+
+    if (m_Damage.size() >= MaxDamageRegions)
+    {
+        m_Damage.clear();
+        m_DamageAll = true;
+        return;
+    }
+
+    m_Damage.push_back(Merged);
+}
+
 void Window::RequestLayout(std::shared_ptr<Container> Request)
 {
     if (!Request)
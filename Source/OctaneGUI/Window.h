@@ -31,6 +31,7 @@ SOFTWARE.
 #include "Mouse.h"
 #include "Popup.h"
 #include "Rect.h"
+#include "VertexBuffer.h"
 
 #include <functional>
 #include <memory>
@@ -51,7 +52,6 @@ class Paint;
 class TextureCache;
 class Theme;
 class Timer;
-class VertexBuffer;
 class WindowContainer;
 
 namespace WindowFlags
@@ -77,6 +77,7 @@ class Window
 {
 public:
     typedef std::function<void(Window*, const VertexBuffer&)> OnPaintSignature;
+    typedef std::function<void(Window*, const VertexBuffer&, const std::vector<Rect>&)> OnPaintRegionSignature;
     typedef std::function<void(Window&, const char*)> OnSetTitleSignature;
     typedef std::function<void(Window&)> OnWindowSignature;
 
@@ -145,6 +146,16 @@ public:
     Window& SetCustomTitleBar(bool CustomTitleBar);
     bool CustomTitleBar() const;
 
+    /// @brief Reorders draw commands by texture after painting to reduce the number of draw calls.
+    ///
+    /// Commands are only reordered where they do not overlap, so the painted result is unchanged.
+    /// This adds CPU work each frame and is disabled by default.
+    ///
+    /// @param SortCommands True to sort the commands before handing them to the renderer.
+    /// @return This Window reference.
+    Window& SetSortCommands(bool SortCommands);
+    bool SortCommands() const;
+
     Window& SetFlags(uint64_t Flags);
     Window& UnsetFlags(uint64_t Flags);
 
@@ -187,7 +198,17 @@ public:
     Mouse::Cursor MouseCursor() const;
 
     void Update();
-    void DoPaint(Paint& Brush);
+    void DoPaint();
+
+    /// @brief The buffer this window paints into.
+    ///
+    /// The buffer is owned by the window and is cleared and reused for every repaint so
+    /// that the allocated memory persists across frames. Use this to reserve capacity up
+    /// front or to query the allocation statistics of the last repaint.
+    ///
+    /// @return VertexBuffer reference.
+    VertexBuffer& GetBuffer();
+    const VertexBuffer& GetBuffer() const;
 
     void Load(const char* JsonStream);
     void Load(const char* JsonStream, ControlList& List);
@@ -202,7 +223,26 @@ public:
     void StartTimer(const std::shared_ptr<Timer>& Object);
     bool ClearTimer(const std::shared_ptr<Timer>& Object);
 
+    /// @brief Milliseconds until the next running timer of this window is due.
+    ///
+    /// @return Zero if a timer is already due or -1 if no timers are running.
+    int NextTimerTimeout() const;
+
+    /// @brief Whether a layout or repaint was requested that the next update or paint will handle.
+    bool HasPendingWork() const;
+
     Window& SetOnPaint(OnPaintSignature&& Fn);
+
+    /// @brief Callback for painting only the damaged regions of the window.
+    ///
+    /// When set, repaints caused only by paint invalidations will contain just the controls
+    /// overlapping the invalidated regions. The callback is then responsible for preserving
+    /// the rest of the previously presented frame. Repaints that require the whole window,
+    /// such as after a layout, still go through the OnPaint callback.
+    ///
+    /// @param Fn The OnPaintRegionSignature callback.
+    /// @return This Window reference.
+    Window& SetOnPaintRegion(OnPaintRegionSignature&& Fn);
     Window& SetOnSetTitle(OnSetTitleSignature&& Fn);
     Window& SetOnSetPosition(OnWindowSignature&& Fn);
     Window& SetOnSetSize(OnWindowSignature&& Fn);
@@ -227,6 +267,8 @@ private:
     Window();
 
     void Populate(ControlList& List) const;
+    void OnInvalidate(const std::shared_ptr<Control>& Focus, InvalidateType Type);
+    void AddDamage(const Rect& Bounds);
     void RequestLayout(std::shared_ptr<Container> Request);
     void UpdateTimers();
     void UpdateFocus(const std::shared_ptr<Control>& Focus);
@@ -242,6 +284,10 @@ private:
     Vector2 m_RenderScale { 1.0f, 1.0f };
     std::shared_ptr<WindowContainer> m_Container { nullptr };
     bool m_Repaint { false };
+    bool m_DamageAll { true };
+    std::vector<Rect> m_Damage {};
+    VertexBuffer m_Buffer {};
+    bool m_SortCommands { false };
     std::weak_ptr<Control> m_Focus {};
     std::weak_ptr<Control> m_Hovered {};
     Popup m_Popup {};
@@ -253,6 +299,7 @@ private:
     std::vector<TimerHandle> m_Timers {};
 
     OnPaintSignature m_OnPaint { nullptr };
+    OnPaintRegionSignature m_OnPaintRegion { nullptr };
     OnContainerSignature m_OnPopupClose { nullptr };
     OnSetTitleSignature m_OnSetTitle { nullptr };
     OnWindowSignature m_OnSetPosition { nullptr };